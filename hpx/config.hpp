@@ -378,6 +378,14 @@
 #  endif
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of idle rounds a worker thread spins before being parked.
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+#  if !defined(HPX_IDLE_SPIN_ROUNDS_MAX)
+#    define HPX_IDLE_SPIN_ROUNDS_MAX 16
+#  endif
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_WRAPPER_HEAP_STEP)
 #  define HPX_WRAPPER_HEAP_STEP 0xFFFFU
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/plugins/binary_filter/bzip2_serialization_filter.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
 #include <hpx/plugins/binary_filter/snappy_serialization_filter.hpp>
 #include <hpx/plugins/binary_filter/zlib_serialization_filter.hpp>
 
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/parallel/executors/deadline_executor.hpp>
 #include <hpx/parallel/executors/default_executor.hpp>
 #include <hpx/parallel/executors/distribution_policy_executor.hpp>
 #include <hpx/parallel/executors/parallel_executor.hpp>
@@ -20,5 +21,6 @@
 #include <hpx/parallel/executors/thread_pool_executors.hpp>
 #include <hpx/parallel/executors/thread_pool_os_executors.hpp>
 #include <hpx/parallel/executors/timed_executors.hpp>
+#include <hpx/parallel/executors/work_first_executor.hpp>
 
 #endif
@@ -0,0 +1,178 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/deadline_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_DEADLINE_EXECUTOR_JAN_27_2019_0520PM)
+#define HPX_PARALLEL_EXECUTORS_DEADLINE_EXECUTOR_JAN_27_2019_0520PM
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/packaged_task.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/deferred_call.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/steady_clock.hpp>
+#include <hpx/util/thread_description.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a deadline_executor creates HPX threads which carry an absolute
+    /// deadline. The deadline of each new thread is the point in time the
+    /// thread was created at plus the relative deadline the executor was
+    /// constructed with.
+    ///
+    /// Schedulers supporting deadlines (\a --hpx:queuing=edf) execute the
+    /// threads with the earliest deadline first, all other schedulers ignore
+    /// the deadlines.
+    ///
+    /// This executor conforms to the concepts of a OneWayExecutor and a
+    /// TwoWayExecutor
+    struct deadline_executor
+    {
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        typedef parallel_execution_tag execution_category;
+
+        /// Create a new deadline executor
+        ///
+        /// \param rel_time The time after the creation of a new HPX thread by
+        ///                 which it should have been executed.
+        /// \param priority The priority of the created HPX threads.
+        /// \param stacksize The stack size of the created HPX threads.
+        explicit deadline_executor(hpx::util::steady_duration const& rel_time,
+                threads::thread_priority priority =
+                    threads::thread_priority_normal,
+                threads::thread_stacksize stacksize =
+                    threads::thread_stacksize_default)
+          : rel_time_(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    rel_time.value()).count()))
+          , priority_(priority)
+          , stacksize_(stacksize)
+        {}
+
+        /// \cond NOINTERNAL
+        bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return rel_time_ == rhs.rel_time_ &&
+                priority_ == rhs.priority_ && stacksize_ == rhs.stacksize_;
+        }
+
+        bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        deadline_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+
+        // OneWayExecutor interface
+        template <typename F, typename ... Ts>
+        typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        sync_execute(F && f, Ts &&... ts) const
+        {
+            return async_execute(
+                std::forward<F>(f), std::forward<Ts>(ts)...).get();
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        >
+        async_execute(F && f, Ts &&... ts) const
+        {
+            typedef typename hpx::util::detail::invoke_deferred_result<
+                    F, Ts...
+                >::type result_type;
+
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::deadline_executor::async_execute");
+
+            lcos::local::packaged_task<result_type()> task(
+                hpx::util::deferred_call(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+            hpx::future<result_type> result = task.get_future();
+
+            spawn(desc, std::move(task));
+            return result;
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts) const
+        {
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::deadline_executor::post");
+
+            spawn(desc, hpx::util::deferred_call(
+                std::forward<F>(f), std::forward<Ts>(ts)...));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename F>
+        void spawn(hpx::util::thread_description const& desc, F && f) const
+        {
+            threads::thread_init_data data(
+                threads::thread_function_type(
+                    applier::detail::thread_function_nullary<
+                        typename std::decay<F>::type
+                    >{std::forward<F>(f)}),
+                desc, 0, priority_, threads::thread_schedule_hint(),
+                threads::get_stack_size(stacksize_));
+            data.deadline = hpx::util::high_resolution_clock::now() + rel_time_;
+
+            threads::register_thread_plain(data);
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar & rel_time_ & priority_ & stacksize_;
+        }
+
+        std::uint64_t rel_time_;
+        threads::thread_priority priority_;
+        threads::thread_stacksize stacksize_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<parallel::execution::deadline_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_two_way_executor<parallel::execution::deadline_executor>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
@@ -0,0 +1,186 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/work_first_executor.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_WORK_FIRST_EXECUTOR_JAN_20_2019_0311PM)
+#define HPX_PARALLEL_EXECUTORS_WORK_FIRST_EXECUTOR_JAN_20_2019_0311PM
+
+#include <hpx/config.hpp>
+#include <hpx/async_launch_policy_dispatch.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/parallel/executors/post_policy_dispatch.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/sync_launch_policy_dispatch.hpp>
+#include <hpx/traits/is_executor.hpp>
+#include <hpx/util/deferred_call.hpp>
+#include <hpx/util/thread_description.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a work_first_executor creates execution agents which are preferably
+    /// executed inline, i.e. directly on the stack of the calling HPX thread
+    /// without creating a new HPX thread (work-first execution). This avoids
+    /// the thread creation overhead for recursive divide-and-conquer
+    /// algorithms.
+    ///
+    /// A new task is executed inline only if the calling HPX thread has
+    /// sufficient stack space left and if the worker thread executing it
+    /// already has enough queued work for idle worker threads to steal. Otherwise
+    /// the new task is launched using \a hpx::launch::fork, i.e. a new HPX
+    /// thread is created and executed right away while the calling HPX thread
+    /// is rescheduled, which makes its continuation available for stealing.
+    /// Outside of HPX threads all tasks are launched using
+    /// \a hpx::launch::async.
+    ///
+    /// This executor conforms to the concepts of a OneWayExecutor and a
+    /// TwoWayExecutor
+    struct work_first_executor
+    {
+        /// Associate the parallel_execution_tag executor tag type as a default
+        /// with this executor.
+        typedef parallel_execution_tag execution_category;
+
+        /// Create a new work-first executor
+        ///
+        /// \param min_queue_length The minimal number of items which have to
+        ///                 be queued for the current worker thread before a
+        ///                 new task is executed inline.
+        /// \param stack_space The minimal number of bytes which have to be
+        ///                 left on the stack of the current HPX thread before
+        ///                 a new task is executed inline.
+        explicit work_first_executor(std::int64_t min_queue_length = 1,
+                std::size_t stack_space = 8 * HPX_THREADS_STACK_OVERHEAD)
+          : min_queue_length_(min_queue_length), stack_space_(stack_space)
+        {}
+
+        /// \cond NOINTERNAL
+        bool operator==(work_first_executor const& rhs) const noexcept
+        {
+            return min_queue_length_ == rhs.min_queue_length_ &&
+                stack_space_ == rhs.stack_space_;
+        }
+
+        bool operator!=(work_first_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        work_first_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        /// \cond NOINTERNAL
+
+        // OneWayExecutor interface
+        template <typename F, typename ... Ts>
+        static typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        sync_execute(F && f, Ts &&... ts)
+        {
+            return hpx::detail::sync_launch_policy_dispatch<
+                launch::sync_policy>::call(launch::sync, std::forward<F>(f),
+                std::forward<Ts>(ts)...);
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename hpx::util::detail::invoke_deferred_result<F, Ts...>::type
+        >
+        async_execute(F && f, Ts &&... ts) const
+        {
+            if (nullptr == threads::get_self_ptr())
+            {
+                return hpx::detail::async_launch_policy_dispatch<
+                    launch::async_policy>::call(launch::async,
+                    std::forward<F>(f), std::forward<Ts>(ts)...);
+            }
+
+            if (execute_inline())
+            {
+                typedef typename hpx::util::detail::invoke_deferred_result<
+                        F, Ts...
+                    >::type result_type;
+
+                using is_void = typename std::is_void<result_type>::type;
+                return hpx::detail::call_sync(is_void{},
+                    std::forward<F>(f), std::forward<Ts>(ts)...);
+            }
+
+            return hpx::detail::async_launch_policy_dispatch<
+                launch::fork_policy>::call(launch::fork,
+                std::forward<F>(f), std::forward<Ts>(ts)...);
+        }
+
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts) const
+        {
+            hpx::util::thread_description desc(f,
+                "hpx::parallel::execution::work_first_executor::post");
+
+            if (nullptr == threads::get_self_ptr())
+            {
+                detail::post_policy_dispatch<launch::async_policy>::call(
+                    desc, launch::async, std::forward<F>(f),
+                    std::forward<Ts>(ts)...);
+            }
+            else
+            {
+                detail::post_policy_dispatch<launch::fork_policy>::call(
+                    desc, launch::fork, std::forward<F>(f),
+                    std::forward<Ts>(ts)...);
+            }
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        bool execute_inline() const
+        {
+            return this_thread::has_sufficient_stack_space(stack_space_) &&
+                this_thread::get_local_queue_length() >= min_queue_length_;
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar & min_queue_length_ & stack_space_;
+        }
+
+        std::int64_t min_queue_length_;
+        std::size_t stack_space_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_one_way_executor<parallel::execution::work_first_executor>
+      : std::true_type
+    {};
+
+    template <>
+    struct is_two_way_executor<parallel::execution::work_first_executor>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
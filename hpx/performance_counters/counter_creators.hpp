@@ -164,6 +164,22 @@ namespace hpx { namespace performance_counters
         counter_info const& info, discover_counter_func const& f,
         discover_counters_mode mode, error_code& ec);
 #endif
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation function for per-thread-description profiling counters
+    HPX_API_EXPORT naming::gid_type thread_description_counter_creator(
+        counter_info const& info,
+        hpx::util::function_nonser<
+            std::int64_t(std::string const&, bool)
+        > const& f,
+        error_code& ec);
+
+    // Discoverer function for per-thread-description profiling counters
+    HPX_API_EXPORT bool thread_description_counter_discoverer(
+        counter_info const& info, discover_counter_func const& f,
+        discover_counters_mode mode, error_code& ec);
+#endif
 }}
 
 #endif
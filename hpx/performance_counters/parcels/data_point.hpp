@@ -26,6 +26,8 @@ namespace hpx { namespace performance_counters { namespace parcels
           , num_parcels_(0)
           , raw_bytes_(0)
           , buffer_allocate_time_(0)
+          , action_(nullptr)
+          , locality_id_(naming::invalid_locality_id)
         {}
 
         std::size_t bytes_;           ///< number of bytes on tyhe wire for this parcel
@@ -40,6 +42,11 @@ namespace hpx { namespace performance_counters { namespace parcels
                                    ///< this parcel (uncompressed)
 
         std::int64_t buffer_allocate_time_; ///< The time spent for allocating buffers
+
+        char const* action_;       ///< name of the action of the first parcel
+                                   ///< in this message (sender side only)
+        std::uint32_t locality_id_;   ///< id of the locality this message
+                                   ///< is sent to (sender side only)
     };
 }}}
 
@@ -35,6 +35,7 @@ namespace hpx { namespace plugins { namespace compression
         void load(void* dst, std::size_t dst_count);
         void save(void const* src, std::size_t src_count);
         bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+        std::size_t get_max_flush_length(std::size_t size) const;
 
         void set_max_length(std::size_t size);
         std::size_t init_data(char const* buffer,
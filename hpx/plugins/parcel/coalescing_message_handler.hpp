@@ -78,6 +78,10 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+        void update_max_latency();
+
+        void update_adaptive_parameters(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +94,15 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing: the number of parcels to coalesce and the
+        // flush interval are derived from the observed time between parcels,
+        // bounded by num_coalesced_parcels_ and max_latency_
+        bool adaptive_;
+        std::size_t max_latency_;
+        double average_time_between_parcels_;
+        std::size_t adaptive_num_coalesced_parcels_;
+        std::size_t adaptive_interval_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
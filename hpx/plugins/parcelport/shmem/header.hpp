@@ -0,0 +1,87 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_HEADER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // Every message written to a ring buffer starts with this header. It is
+    // followed by the transmission chunks, the serialized parcel data, and
+    // the data of all zero-copy chunks (in this order).
+    struct header
+    {
+        header()
+          : size_(0), numbytes_(0), num_chunks_first_(0),
+            num_chunks_second_(0)
+        {}
+
+        template <typename Buffer>
+        explicit header(Buffer const& buffer)
+          : size_(static_cast<std::uint64_t>(buffer.size_)),
+            numbytes_(static_cast<std::uint64_t>(buffer.data_size_)),
+            num_chunks_first_(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first)),
+            num_chunks_second_(
+                static_cast<std::uint32_t>(buffer.num_chunks_.second))
+        {}
+
+        void assert_valid() const
+        {
+            HPX_ASSERT(size_ != 0);
+        }
+
+        std::uint64_t size() const
+        {
+            return size_;
+        }
+
+        std::uint64_t numbytes() const
+        {
+            return numbytes_;
+        }
+
+        std::uint32_t num_zero_copy_chunks() const
+        {
+            return num_chunks_first_;
+        }
+
+        std::uint32_t num_non_zero_copy_chunks() const
+        {
+            return num_chunks_second_;
+        }
+
+        // the transmission chunks are sent only if zero-copy chunks are
+        // present
+        std::size_t num_transmission_chunks() const
+        {
+            if (num_chunks_first_ == 0)
+                return 0;
+            return static_cast<std::size_t>(num_chunks_first_) +
+                num_chunks_second_;
+        }
+
+    private:
+        std::uint64_t size_;
+        std::uint64_t numbytes_;
+        std::uint32_t num_chunks_first_;
+        std::uint32_t num_chunks_second_;
+    };
+}}}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,120 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_LOCALITY_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+
+#include <boost/io/ios_state.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        // A shared memory endpoint is identified by the host it lives on and
+        // the process id of the owning locality. The token is stored in the
+        // inbound segment of that locality as well, it protects against
+        // connecting to a stale segment left behind by a process which had
+        // the same process id.
+        class locality
+        {
+        public:
+            locality()
+              : pid_(-1), token_(0)
+            {}
+
+            locality(std::string host, std::int32_t pid, std::uint64_t token)
+              : host_(std::move(host)), pid_(pid), token_(token)
+            {}
+
+            std::string const& host() const
+            {
+                return host_;
+            }
+
+            std::int32_t pid() const
+            {
+                return pid_;
+            }
+
+            std::uint64_t token() const
+            {
+                return token_;
+            }
+
+            static const char *type()
+            {
+                return "shmem";
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return pid_ != -1;
+            }
+
+            void save(serialization::output_archive & ar) const
+            {
+                ar << host_ << pid_ << token_;
+            }
+
+            void load(serialization::input_archive & ar)
+            {
+                ar >> host_ >> pid_ >> token_;
+            }
+
+        private:
+            friend bool operator==(locality const & lhs, locality const & rhs)
+            {
+                return lhs.pid_ == rhs.pid_ && lhs.token_ == rhs.token_ &&
+                    lhs.host_ == rhs.host_;
+            }
+
+            friend bool operator<(locality const & lhs, locality const & rhs)
+            {
+                if (lhs.host_ != rhs.host_)
+                    return lhs.host_ < rhs.host_;
+                if (lhs.pid_ != rhs.pid_)
+                    return lhs.pid_ < rhs.pid_;
+                return lhs.token_ < rhs.token_;
+            }
+
+            friend std::size_t hash_value(locality const & loc)
+            {
+                return static_cast<std::size_t>(loc.pid_) ^
+                    static_cast<std::size_t>(loc.token_);
+            }
+
+            friend std::ostream & operator<<(std::ostream & os, locality const & loc)
+            {
+                boost::io::ios_flags_saver ifs(os);
+                os << loc.host_ << ":" << loc.pid_;
+
+                return os;
+            }
+
+            std::string host_;
+            std::int32_t pid_;
+            std::uint64_t token_;
+        };
+    }}
+}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,205 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RECEIVER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    // The receiver drains the inbound ring buffer of this locality. As the
+    // producers write complete messages while holding the producer lock,
+    // the messages can be consumed strictly in sequence.
+    template <typename Parcelport>
+    struct receiver
+    {
+    private:
+        enum connection_state
+        {
+            initialized
+          , rcvd_header
+          , rcvd_transmission_chunks
+          , rcvd_data
+        };
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        typedef std::vector<char>
+            data_type;
+        typedef parcel_buffer<data_type, data_type> buffer_type;
+
+    public:
+        receiver(Parcelport & pp, std::unique_ptr<ring_buffer> inbound)
+          : state_(initialized)
+          , inbound_(std::move(inbound))
+          , offset_(0)
+          , chunks_idx_(0)
+          , has_progress_(false)
+          , pp_(pp)
+        {}
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+            if (!l)
+                return false;
+
+            has_progress_ = false;
+            while (receive(num_thread))
+                /**/;
+
+            return has_progress_;
+        }
+
+    private:
+        // returns true if a complete message was received
+        bool receive(std::size_t num_thread)
+        {
+            switch (state_)
+            {
+                case initialized:
+                    return receive_header(num_thread);
+                case rcvd_header:
+                    return receive_transmission_chunks(num_thread);
+                case rcvd_transmission_chunks:
+                    return receive_data(num_thread);
+                case rcvd_data:
+                    return receive_chunks(num_thread);
+                default:
+                    HPX_ASSERT(false);
+            }
+            return false;
+        }
+
+        bool receive_header(std::size_t num_thread)
+        {
+            if (!read(&header_, sizeof(header_))) return false;
+
+            header_.assert_valid();
+
+            performance_counters::parcels::data_point& data = buffer_.data_point_;
+            data.time_ = util::high_resolution_clock::now();
+            data.bytes_ = static_cast<std::size_t>(header_.numbytes());
+
+            buffer_.size_ = header_.size();
+            buffer_.data_size_ = header_.numbytes();
+            buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
+            buffer_.num_chunks_ = buffer_type::count_chunks_type(
+                header_.num_zero_copy_chunks(),
+                header_.num_non_zero_copy_chunks());
+
+            buffer_.transmission_chunks_.resize(
+                header_.num_transmission_chunks());
+            buffer_.chunks_.resize(header_.num_zero_copy_chunks());
+
+            state_ = rcvd_header;
+            return receive_transmission_chunks(num_thread);
+        }
+
+        bool receive_transmission_chunks(std::size_t num_thread)
+        {
+            std::vector<buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            if (!chunks.empty() && !read(chunks.data(),
+                    chunks.size() * sizeof(buffer_type::transmission_chunk_type)))
+            {
+                return false;
+            }
+
+            state_ = rcvd_transmission_chunks;
+            return receive_data(num_thread);
+        }
+
+        bool receive_data(std::size_t num_thread)
+        {
+            if (!read(buffer_.data_.data(), buffer_.data_.size())) return false;
+
+            state_ = rcvd_data;
+            return receive_chunks(num_thread);
+        }
+
+        bool receive_chunks(std::size_t num_thread)
+        {
+            while (chunks_idx_ < buffer_.chunks_.size())
+            {
+                std::size_t idx = chunks_idx_;
+                data_type& c = buffer_.chunks_[idx];
+                if (offset_ == 0)
+                {
+                    c.resize(static_cast<std::size_t>(
+                        buffer_.transmission_chunks_[idx].second));
+                }
+
+                if (!read(c.data(), c.size())) return false;
+
+                ++chunks_idx_;
+            }
+
+            performance_counters::parcels::data_point& data = buffer_.data_point_;
+            data.time_ = util::high_resolution_clock::now() - data.time_;
+
+            decode_parcels(pp_, std::move(buffer_), num_thread);
+
+            buffer_.clear();
+            chunks_idx_ = 0;
+            state_ = initialized;
+
+            return true;
+        }
+
+        // read the remaining part of the given block from the ring buffer,
+        // returns true if the block was read completely
+        bool read(void* data, std::size_t size)
+        {
+            std::size_t count = inbound_->read(
+                static_cast<char*>(data) + offset_, size - offset_);
+            if (count != 0)
+                has_progress_ = true;
+
+            offset_ += count;
+            if (offset_ != size) return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        mutex_type mtx_;
+
+        connection_state state_;
+        std::unique_ptr<ring_buffer> inbound_;
+
+        header header_;
+        buffer_type buffer_;
+
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+        bool has_progress_;
+
+        Parcelport & pp_;
+    };
+}}}}
+
+#endif
+
+#endif
+
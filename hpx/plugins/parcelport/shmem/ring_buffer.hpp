@@ -0,0 +1,92 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_RING_BUFFER_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_RING_BUFFER_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Every locality owns exactly one inbound ring buffer which is placed in
+    // a POSIX shared memory segment named after its process id. All other
+    // localities on the same host map this segment and write their messages
+    // into it, the owner is the only consumer.
+    //
+    // The producers serialize their access through a lock living in the
+    // segment itself. A producer holds on to this lock for the whole
+    // message, which allows to stream messages larger than the ring. The
+    // lock holds the process id of its owner, a producer which died while
+    // holding the lock is detected by the other producers.
+    class HPX_EXPORT ring_buffer
+    {
+    private:
+        struct segment_header;
+
+        ring_buffer(std::string name, void* base, std::size_t mapped_size,
+            bool owner);
+
+    public:
+        HPX_NON_COPYABLE(ring_buffer);
+
+        ~ring_buffer();
+
+        // create the inbound segment for the given process, any stale segment
+        // with the same name is removed first
+        static std::unique_ptr<ring_buffer> create(std::int32_t pid,
+            std::uint64_t token, std::size_t capacity);
+
+        // open the inbound segment of another locality, returns an empty
+        // pointer if the segment does not exist or does not carry the
+        // expected token
+        static std::shared_ptr<ring_buffer> open(std::int32_t pid,
+            std::uint64_t token);
+
+        static std::string segment_name(std::int32_t pid);
+
+        std::size_t capacity() const;
+
+        // cross-process producer lock, held for the duration of one message,
+        // throws if the owning process has died while holding the lock
+        bool try_lock_producer();
+        void unlock_producer();
+
+        // Copy as many bytes as possible into (out of) the ring, returns the
+        // number of bytes actually transferred. Neither of the functions
+        // blocks.
+        std::size_t write(void const* data, std::size_t size);
+        std::size_t read(void* data, std::size_t size);
+
+        // return whether there is any data waiting to be consumed
+        bool empty() const;
+
+    private:
+        // the ring data starts at the first cache line after the header
+        static std::size_t data_offset();
+
+        segment_header& header() const;
+        char* data() const;
+
+        std::string name_;
+        void* base_;
+        std::size_t mapped_size_;
+        bool owner_;
+        std::atomic<std::size_t> failed_lock_attempts_;
+    };
+}}}}
+
+#endif
+
+#endif
+
@@ -0,0 +1,276 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+#define HPX_PARCELSET_POLICIES_SHMEM_SENDER_CONNECTION_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/performance_counters/parcels/gatherer.hpp>
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/unique_function.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    // A sender connection streams one message at a time into the inbound
+    // ring buffer of the destination locality. Zero-copy chunks are copied
+    // straight from the memory they were serialized from into the shared
+    // segment, without staging them in an intermediate buffer.
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef util::function_nonser<
+            void(boost::system::error_code const&, parcel const&)
+        > write_handler_type;
+
+        typedef std::vector<char> data_type;
+
+        enum connection_state
+        {
+            initialized
+          , sent_header
+          , sent_transmission_chunks
+          , sent_data
+          , sent_chunks
+        };
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+    public:
+        sender_connection(
+            sender_type * s
+          , std::shared_ptr<ring_buffer> ring
+          , parcelset::locality const& there
+          , parcelset::parcelport* pp
+        )
+          : state_(initialized)
+          , sender_(s)
+          , ring_(std::move(ring))
+          , locked_(false)
+          , offset_(0)
+          , chunks_idx_(0)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            buffer_.data_point_.time_ = util::high_resolution_clock::now();
+            chunks_idx_ = 0;
+            offset_ = 0;
+            header_ = header(buffer_);
+            header_.assert_valid();
+
+            state_ = initialized;
+
+            handler_ = std::forward<Handler>(handler);
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        bool send()
+        {
+            switch(state_)
+            {
+                case initialized:
+                    return send_header();
+                case sent_header:
+                    return send_transmission_chunks();
+                case sent_transmission_chunks:
+                    return send_data();
+                case sent_data:
+                    return send_chunks();
+                case sent_chunks:
+                    return done();
+                default:
+                    HPX_ASSERT(false);
+            }
+
+            return false;
+        }
+
+        bool send_header()
+        {
+            HPX_ASSERT(state_ == initialized);
+
+            // the whole message has to be written while holding the
+            // producer lock of the destination ring
+            if(!locked_)
+            {
+                if(!ring_->try_lock_producer()) return false;
+                locked_ = true;
+            }
+
+            if(!write(&header_, sizeof(header_))) return false;
+
+            state_ = sent_header;
+            return send_transmission_chunks();
+        }
+
+        bool send_transmission_chunks()
+        {
+            HPX_ASSERT(state_ == sent_header);
+
+            std::vector<typename parcel_buffer_type::transmission_chunk_type>& chunks =
+                buffer_.transmission_chunks_;
+            HPX_ASSERT(chunks.size() == header_.num_transmission_chunks());
+
+            if(!chunks.empty() && !write(chunks.data(),
+                    chunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type)))
+            {
+                return false;
+            }
+
+            state_ = sent_transmission_chunks;
+            return send_data();
+        }
+
+        bool send_data()
+        {
+            HPX_ASSERT(state_ == sent_transmission_chunks);
+
+            if(!write(buffer_.data_.data(), buffer_.data_.size())) return false;
+
+            state_ = sent_data;
+            return send_chunks();
+        }
+
+        bool send_chunks()
+        {
+            HPX_ASSERT(state_ == sent_data);
+
+            while(chunks_idx_ < buffer_.chunks_.size())
+            {
+                serialization::serialization_chunk& c = buffer_.chunks_[chunks_idx_];
+                if(c.type_ == serialization::chunk_type_pointer)
+                {
+                    if(!write(c.data_.cpos_, c.size_)) return false;
+                }
+
+                chunks_idx_++;
+            }
+
+            state_ = sent_chunks;
+
+            return done();
+        }
+
+        bool done()
+        {
+            HPX_ASSERT(locked_);
+            ring_->unlock_producer();
+            locked_ = false;
+
+            error_code ec;
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                util::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+
+            state_ = initialized;
+
+            return true;
+        }
+
+        // write the remaining part of the given block to the ring buffer,
+        // returns true if the block was written completely
+        bool write(void const* data, std::size_t size)
+        {
+            offset_ += ring_->write(
+                static_cast<char const*>(data) + offset_, size - offset_);
+            if(offset_ != size) return false;
+
+            offset_ = 0;
+            return true;
+        }
+
+        connection_state state_;
+        sender_type * sender_;
+        std::shared_ptr<ring_buffer> ring_;
+        bool locked_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+        header header_;
+
+        std::size_t offset_;
+        std::size_t chunks_idx_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
+
+#endif
+
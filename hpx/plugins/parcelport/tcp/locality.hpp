@@ -22,7 +22,9 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/io/ios_state.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 
 namespace hpx { namespace parcelset
@@ -84,6 +86,11 @@ namespace hpx { namespace parcelset
                     (lhs.address_ == rhs.address_ && lhs.port_ < rhs.port_);
             }
 
+            friend std::size_t hash_value(locality const & loc)
+            {
+                return std::hash<std::string>()(loc.address_) ^ loc.port_;
+            }
+
             friend std::ostream & operator<<(std::ostream & os, locality const & loc)
             {
                 boost::io::ios_flags_saver ifs(os);
@@ -23,6 +23,7 @@
 #include <hpx/runtime/parcelset/parcelport_connection.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind.hpp>
+#include <hpx/util/buffer_pool.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/protect.hpp>
 
@@ -45,8 +46,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
 
+    // zero-copy chunks are received into buffers from the pool of the
+    // parcelport, which can be shared with the decoded data
     class receiver
-      : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
+      : public parcelport_connection<receiver, std::vector<char>,
+            util::buffer_pool<char>::shared_buffer_type>
     {
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
@@ -255,14 +259,17 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                     static_cast<std::size_t>(
                         static_cast<std::uint32_t>(buffer_.num_chunks_.first));
 
+                util::buffer_pool<char>& pool =
+                    parcelport_.get_receive_buffer_pool();
+
                 buffer_.chunks_.resize(num_zero_copy_chunks);
                 for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                 {
                     std::size_t chunk_size = static_cast<std::size_t>(
                         buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
+                    buffer_.chunks_[i] = pool.get_pooled_buffer(chunk_size);
                     buffers.push_back(
-                        boost::asio::buffer(buffer_.chunks_[i].data(), chunk_size));
+                        boost::asio::buffer(buffer_.chunks_[i]->data(), chunk_size));
                 }
 
                 // Start an asynchronous call to receive the data.
@@ -125,7 +125,11 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             // Write the serialized data to the socket. We use "gather-write"
             // to send both the header and the data in a single write operation.
+            // Zero-copy chunks are sent straight from the memory they were
+            // serialized from, asio hands all buffers to a single vectored
+            // write (sendmsg) whenever possible.
             std::vector<boost::asio::const_buffer> buffers;
+            buffers.reserve(5 + buffer_.chunks_.size());
             buffers.push_back(boost::asio::buffer(&buffer_.size_,
                 sizeof(buffer_.size_)));
             buffers.push_back(boost::asio::buffer(&buffer_.data_size_,
@@ -101,9 +101,21 @@ namespace hpx { namespace plugins
                 "zero_copy_optimization = ${HPX_PARCEL_" + name_uc +
                     "_ZERO_COPY_OPTIMIZATION:"
                     "$[hpx.parcel.zero_copy_optimization]}",
+                "zero_copy_serialization_threshold = ${HPX_PARCEL_" + name_uc +
+                    "_ZERO_COPY_SERIALIZATION_THRESHOLD:"
+                    "$[hpx.parcel.zero_copy_serialization_threshold]}",
+                "connection_cache_policy = ${HPX_PARCEL_" + name_uc +
+                    "_CONNECTION_CACHE_POLICY:"
+                    "$[hpx.parcel.connection_cache_policy]}",
                 "async_serialization = ${HPX_PARCEL_" + name_uc +
                     "_ASYNC_SERIALIZATION:"
                     "$[hpx.parcel.async_serialization]}",
+                "adaptive_compression = ${HPX_PARCEL_" + name_uc +
+                    "_ADAPTIVE_COMPRESSION:"
+                    "$[hpx.parcel.adaptive_compression]}",
+                "adaptive_compression_threshold = ${HPX_PARCEL_" + name_uc +
+                    "_ADAPTIVE_COMPRESSION_THRESHOLD:"
+                    "$[hpx.parcel.adaptive_compression_threshold]}",
                 "priority = ${HPX_PARCEL_" + name_uc +
                     "_PRIORITY:" + traits::plugin_config_data<Parcelport>::priority()
                                  + "}"
@@ -19,6 +19,7 @@
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/deferred_call.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/logging.hpp>
 
@@ -28,12 +29,42 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace parcelset
 {
+    namespace detail
+    {
+        // received zero-copy chunks are either held directly or through a
+        // shared_ptr (allowing to share their memory with the decoded data)
+        template <typename Chunk>
+        Chunk& get_chunk(Chunk& c)
+        {
+            return c;
+        }
+
+        template <typename Chunk>
+        Chunk& get_chunk(std::shared_ptr<Chunk>& c)
+        {
+            return *c;
+        }
+
+        template <typename Chunk>
+        std::shared_ptr<void> get_chunk_owner(Chunk const&)
+        {
+            return std::shared_ptr<void>();
+        }
+
+        template <typename Chunk>
+        std::shared_ptr<void> get_chunk_owner(std::shared_ptr<Chunk> const& c)
+        {
+            return c;
+        }
+    }
+
     template <typename Buffer>
     std::vector<serialization::serialization_chunk> decode_chunks(Buffer & buffer)
     {
@@ -63,10 +94,11 @@ namespace hpx { namespace parcelset
                 std::size_t second = static_cast<std::size_t>(
                     static_cast<std::uint64_t>(c.second));
 
-                HPX_ASSERT(buffer.chunks_[i].size() == second);
+                auto& chunk = detail::get_chunk(buffer.chunks_[i]);
+                HPX_ASSERT(chunk.size() == second);
 
                 chunks[first] = serialization::create_pointer_chunk(
-                        buffer.chunks_[i].data(), second);
+                        chunk.data(), second);
             }
 
             std::size_t index = 0;
@@ -102,6 +134,55 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    // Collect the owners of the received zero-copy chunks (if any) in the
+    // order of the chunks returned from decode_chunks.
+    template <typename Buffer>
+    std::vector<std::shared_ptr<void> > decode_chunk_owners(Buffer & buffer)
+    {
+        std::vector<std::shared_ptr<void> > owners;
+
+        std::size_t num_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first));
+        std::size_t num_non_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.second));
+
+        for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+        {
+            std::shared_ptr<void> owner =
+                detail::get_chunk_owner(buffer.chunks_[i]);
+            if (!owner)
+                continue;
+
+            if (owners.empty())
+                owners.resize(num_zero_copy_chunks + num_non_zero_copy_chunks);
+
+            std::size_t first = static_cast<std::size_t>(
+                static_cast<std::uint64_t>(buffer.transmission_chunks_[i].first));
+            owners[first] = std::move(owner);
+        }
+
+        return owners;
+    }
+
+    namespace detail
+    {
+        // account for the time between receiving the message and scheduling
+        // the thread for the given parcel
+        template <typename Parcelport>
+        void add_receive_latency(Parcelport& pp, parcel const& p,
+            std::int64_t receive_time)
+        {
+            std::int64_t now = util::high_resolution_clock::now();
+            pp.get_latency_histograms().add_data(
+                latency_receive_to_schedule,
+                p.get_action()->get_action_name(),
+                naming::get_locality_id_from_gid(p.source_id().get_gid()),
+                now - receive_time);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -110,6 +191,7 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::vector<std::shared_ptr<void> > const* chunk_owners = nullptr
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -124,11 +206,19 @@ namespace hpx { namespace parcelset
                 performance_counters::parcels::data_point& data =
                     buffer.data_point_;
 
+                // the message has been received completely
+                std::int64_t receive_time = 0;
+                if (pp.get_latency_histograms().enabled(
+                        detail::latency_receive_to_schedule))
+                {
+                    receive_time = util::high_resolution_clock::now();
+                }
+
                 {
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -196,6 +286,8 @@ namespace hpx { namespace parcelset
                         // If we got a direct action,
                         else if (deferred_schedule)
                             deferred_parcels.push_back(std::move(p));
+                        else if (receive_time != 0)
+                            detail::add_receive_latency(pp, p, receive_time);
 
                         // be sure not to measure add_parcel as serialization time
                         overall_add_parcel_time += timer.elapsed_nanoseconds() -
@@ -213,8 +305,13 @@ namespace hpx { namespace parcelset
                             // schedule all but the first parcel on a new thread.
                             hpx::applier::register_thread_nullary(
                                 util::deferred_call(
-                                    [num_thread](parcel&& p)
+                                    [&pp, num_thread, receive_time](parcel&& p)
                                     {
+                                        if (receive_time != 0)
+                                        {
+                                            detail::add_receive_latency(
+                                                pp, p, receive_time);
+                                        }
                                         p.schedule_action(num_thread);
                                     }, std::move(deferred_parcels[i])),
                                 "schedule_parcel",
@@ -226,6 +323,11 @@ namespace hpx { namespace parcelset
                         }
                         // If we are the first deferred parcel, we don't need to spin
                         // a new thread...
+                        if (receive_time != 0)
+                        {
+                            detail::add_receive_latency(
+                                pp, deferred_parcels[0], receive_time);
+                        }
                         deferred_parcels[0].schedule_action(num_thread);
                     }
                 }
@@ -279,8 +381,10 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
+        std::vector<std::shared_ptr<void> >
+            chunk_owners(decode_chunk_owners(buffer));
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread, &chunk_owners);
     }
 
     template <typename Parcelport, typename Buffer>
@@ -0,0 +1,106 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARCELSET_ADAPTIVE_COMPRESSION_HPP)
+#define HPX_PARCELSET_ADAPTIVE_COMPRESSION_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/serialization/serialization_fwd.hpp>
+#include <hpx/util_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    // Chooses the binary filter used to compress messages which are not
+    // compressed by their actions already. Only messages of at least the
+    // configured size are considered. For each codec the compression ratio
+    // and the time needed to encode a byte are measured, together with the
+    // throughput of the link. The codec minimizing the estimated time for
+    // encoding and transferring a message is used, no compression is chosen
+    // if it would be faster. Every codec is retried now and then to keep the
+    // estimates current.
+    class HPX_EXPORT adaptive_compression
+    {
+        typedef lcos::local::spinlock mutex_type;
+
+    public:
+        adaptive_compression(util::runtime_configuration const& ini,
+            std::string const& type);
+
+        bool enabled() const
+        {
+            return enabled_;
+        }
+
+        // Return the codec to use for a message of the given (estimated)
+        // size, -1 if the message should not be compressed. Codecs which
+        // can't compress that much data are never chosen.
+        int select_codec(std::size_t size);
+
+        // Create the filter for the given codec, returns nullptr if the
+        // codec is not available.
+        serialization::binary_filter* create_filter(int codec);
+
+        // Account for an encoded message (codec is -1 for messages sent
+        // uncompressed), time is in nanoseconds.
+        void add_encoded_data(int codec, std::size_t raw_bytes,
+            std::size_t bytes, std::int64_t time);
+
+        // Account for a message which has been sent, time is in nanoseconds.
+        void add_sent_data(std::size_t bytes, std::int64_t time);
+
+        // counter values
+        std::int64_t get_compressed_messages(bool reset);
+        std::int64_t get_compressed_raw_bytes(bool reset);
+        std::int64_t get_compressed_bytes(bool reset);
+        std::int64_t get_compression_time(bool reset);
+
+    private:
+        struct codec_data
+        {
+            codec_data(std::string const& name, std::size_t max_size)
+              : name_(name + "_serialization_filter")
+              , max_size_(max_size)
+              , available_(true)
+              , ratio_(1.0)
+              , cost_(0.0)
+              , samples_(0)
+            {}
+
+            std::string name_;      // name of the binary filter
+            std::size_t max_size_;  // maximal size of the data to compress
+            bool available_;        // the filter plugin could be loaded
+            double ratio_;          // compressed bytes per raw byte
+            double cost_;           // encoding time per raw byte (ns)
+            std::uint64_t samples_;
+        };
+
+        mutex_type mtx_;
+
+        bool enabled_;
+        std::size_t threshold_;
+
+        std::vector<codec_data> codecs_;
+
+        double uncompressed_cost_;  // encoding time per byte (ns)
+        std::uint64_t uncompressed_samples_;
+        double bandwidth_;          // bytes per ns
+        std::uint64_t decisions_;
+        std::size_t next_probe_;
+
+        std::atomic<std::int64_t> compressed_messages_;
+        std::atomic<std::int64_t> compressed_raw_bytes_;
+        std::atomic<std::int64_t> compressed_bytes_;
+        std::atomic<std::int64_t> compression_time_;
+    };
+}}}
+
+#endif
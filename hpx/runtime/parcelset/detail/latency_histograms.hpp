@@ -0,0 +1,126 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARCELSET_LATENCY_HISTOGRAMS_HPP)
+#define HPX_PARCELSET_LATENCY_HISTOGRAMS_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/runtime/naming_fwd.hpp>
+#include <hpx/util/function.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    // The stages of the parcel layer for which latencies are collected
+    enum latency_stage
+    {
+        latency_enqueue_to_send = 0,    // parcel handed to the parcelport
+                                        // until its message is encoded
+        latency_serialization = 1,      // serialization of a parcel
+        latency_wire = 2,               // sending a message
+        latency_receive_to_schedule = 3,    // message received until the
+                                        // thread of a parcel is scheduled
+        num_latency_stages = 4
+    };
+
+    // Collects the histograms of the latencies of the parcel layer. Each
+    // histogram covers one stage and either all or a single action and
+    // destination (or source) locality. Histograms are created only once
+    // a performance counter asks for them, no data is collected for a stage
+    // before that.
+    //
+    // Adding data does not acquire any lock: the histograms of each stage
+    // form a list which is only ever prepended to (under the lock) and the
+    // buckets are atomic counters. hpx::util::histogram is not used as it
+    // would have to be protected by a lock for every parcel sent or
+    // received. The counter values have the same layout as the ones of the
+    // histogram counters based on hpx::util::histogram (see the coalescing
+    // message handler), which has to be kept for the counter consumers.
+    class HPX_EXPORT latency_histograms
+    {
+        typedef lcos::local::spinlock mutex_type;
+
+        struct histogram_data
+        {
+            histogram_data(std::string const& action,
+                    std::uint32_t locality_id, std::int64_t min_boundary,
+                    std::int64_t max_boundary, std::int64_t num_buckets,
+                    histogram_data* next);
+
+            // Add a measured time to the matching bucket
+            void add(std::int64_t time);
+
+            // Return the normalized bucket values (per mille of all samples)
+            void get(std::vector<std::int64_t>& result, bool reset);
+
+            std::string action_;            // empty for all actions
+            std::uint32_t locality_id_;     // invalid for all localities
+            std::int64_t min_boundary_;
+            std::int64_t max_boundary_;
+            std::int64_t num_buckets_;
+            double bucket_size_;
+
+            // the buckets covering [min_boundary_, max_boundary_) preceded by
+            // the underflow and followed by the overflow bucket
+            std::unique_ptr<std::atomic<std::int64_t>[]> counts_;
+
+            histogram_data* const next_;
+        };
+
+    public:
+        latency_histograms();
+
+        // Return whether any histogram has been created for the given stage
+        bool enabled(latency_stage stage) const
+        {
+            return histograms_[stage].load(std::memory_order_relaxed) !=
+                nullptr;
+        }
+
+        // Add a measured time (nanoseconds) to all matching histograms of
+        // the given stage
+        void add_data(latency_stage stage, char const* action,
+            std::uint32_t locality_id, std::int64_t time);
+
+        // Return the function returning the values of the histogram of the
+        // given stage, action and locality (the histogram is created if
+        // needed)
+        util::function_nonser<std::vector<std::int64_t>(bool)>
+        get_histogram_counter(latency_stage stage, std::string const& action,
+            std::uint32_t locality_id, std::int64_t min_boundary,
+            std::int64_t max_boundary, std::int64_t num_buckets);
+
+    private:
+        std::vector<std::int64_t> get_histogram(histogram_data* data,
+            bool reset);
+
+        mutex_type mtx_;
+
+        // the most recently created histogram of each stage
+        std::atomic<histogram_data*> histograms_[num_latency_stages];
+
+        // owns all histograms (protected by mtx_)
+        std::vector<std::unique_ptr<histogram_data> > storage_;
+    };
+
+    // Creation function for the latency histogram counters of the given
+    // stage, the counter parameters are the name of the action (all actions
+    // if empty), the boundaries and number of buckets of the histogram and
+    // optionally the id of the locality parcels were sent to (received
+    // from).
+    HPX_EXPORT naming::gid_type latency_histogram_counter_creator(
+        performance_counters::counter_info const& info,
+        latency_histograms& histograms, latency_stage stage, error_code& ec);
+}}}
+
+#endif
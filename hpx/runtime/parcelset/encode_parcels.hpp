@@ -21,12 +21,14 @@
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/high_resolution_timer.hpp>
 #include <hpx/util/integer/endian.hpp>
 #include <hpx/util/logging.hpp>
 
 #include <boost/exception/exception.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -152,11 +154,6 @@ namespace hpx
                     std::unique_ptr<serialization::binary_filter> filter(
                         ps[0].get_serialization_filter());
 
-                    int archive_flags = archive_flags_;
-                    if (filter.get() != nullptr)
-                        archive_flags |= serialization::enable_compression;
-
-
                     // preallocate data
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                     {
@@ -166,10 +163,61 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
-                    buffer.data_.reserve(arg_size);
+                    // let the parcelport decide about compressing messages
+                    // whose actions don't ask for compression themselves
+                    detail::adaptive_compression& compression =
+                        pp.get_adaptive_compression();
+
+                    int codec = -1;
+                    if (filter.get() == nullptr && compression.enabled())
+                    {
+                        codec = compression.select_codec(arg_size);
+                        if (codec >= 0)
+                        {
+                            filter.reset(compression.create_filter(codec));
+                            if (filter.get() == nullptr)
+                                codec = -1;
+                        }
+                    }
+
+                    int archive_flags = archive_flags_;
+                    if (filter.get() != nullptr)
+                        archive_flags |= serialization::enable_compression;
+
+                    // compressed data may be larger than its input, make
+                    // room for the worst case to avoid growing the buffer
+                    // while flushing the filter
+                    std::size_t buffer_size = arg_size;
+                    if (filter.get() != nullptr)
+                    {
+                        buffer_size = (std::max)(buffer_size,
+                            filter->get_max_flush_length(arg_size));
+                    }
+                    buffer.data_.reserve(buffer_size);
 
                     buffer.chunks_.reserve(num_chunks);
 
+                    detail::latency_histograms& histograms =
+                        pp.get_latency_histograms();
+                    bool const collect_serialization_latency =
+                        histograms.enabled(detail::latency_serialization);
+
+                    if (histograms.enabled(detail::latency_enqueue_to_send))
+                    {
+                        std::int64_t now = util::high_resolution_clock::now();
+                        for (std::size_t i = 0; i != parcels_sent; ++i)
+                        {
+                            if (ps[i].enqueue_time() == 0)
+                                continue;
+
+                            histograms.add_data(
+                                detail::latency_enqueue_to_send,
+                                ps[i].get_action()->get_action_name(),
+                                ps[i].destination_locality_id(),
+                                now - ps[i].enqueue_time());
+                        }
+                    }
+
                     // mark start of serialization
                     util::high_resolution_timer timer;
 
@@ -182,7 +230,8 @@ namespace hpx
                             buffer.data_
                           , archive_flags
                           , &buffer.chunks_
-                          , filter.get());
+                          , filter.get()
+                          , pp.zero_copy_serialization_threshold());
 
                         if(num_parcels != std::size_t(-1))
                             archive << parcels_sent; //-V128
@@ -191,32 +240,61 @@ namespace hpx
                         {
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             std::size_t archive_pos = archive.current_pos();
-                            std::int64_t serialize_time =
-                                timer.elapsed_nanoseconds();
+                            bool const measure_time = true;
+#else
+                            bool const measure_time =
+                                collect_serialization_latency;
 #endif
+                            std::int64_t serialize_time = measure_time ?
+                                timer.elapsed_nanoseconds() : 0;
 
                             LPT_(debug) << ps[i];
                             archive.set_split_gids(ps[i].split_gids());
                             archive << ps[i];
 
+                            if (measure_time)
+                            {
+                                serialize_time =
+                                    timer.elapsed_nanoseconds() - serialize_time;
+                            }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                             performance_counters::parcels::data_point action_data;
                             action_data.bytes_ = archive.current_pos() - archive_pos;
-                            action_data.serialization_time_ =
-                                timer.elapsed_nanoseconds() - serialize_time;
+                            action_data.serialization_time_ = serialize_time;
                             action_data.num_parcels_ = 1;
                             pp.add_sent_data(
                                 ps[i].get_action()->get_action_name(),
                                 action_data);
 #endif
+
+                            if (collect_serialization_latency)
+                            {
+                                histograms.add_data(
+                                    detail::latency_serialization,
+                                    ps[i].get_action()->get_action_name(),
+                                    ps[i].destination_locality_id(),
+                                    serialize_time);
+                            }
                         }
                         archive.flush();
                         arg_size = archive.bytes_written();
+
+                        pp.add_send_buffer_reallocated_bytes(
+                            archive.bytes_reallocated());
                     }
 
                     // store the time required for serialization
                     buffer.data_point_.serialization_time_ =
                         timer.elapsed_nanoseconds();
+
+                    if (compression.enabled() &&
+                        (codec >= 0 || filter.get() == nullptr))
+                    {
+                        compression.add_encoded_data(codec, arg_size,
+                            buffer.data_.size(),
+                            buffer.data_point_.serialization_time_);
+                    }
                 }
                 catch (hpx::exception const& e) {
                     LPT_(fatal)
@@ -259,6 +337,17 @@ namespace hpx
             }
 
             buffer.data_point_.num_parcels_ = parcels_sent;
+
+            // the time needed for sending the message is accounted for the
+            // action and destination of its first parcel
+            if (parcels_sent != 0)
+            {
+                buffer.data_point_.action_ =
+                    ps[0].get_action()->get_action_name();
+                buffer.data_point_.locality_id_ =
+                    ps[0].destination_locality_id();
+            }
+
             detail::encode_finalize(buffer, arg_size);
 
             return parcels_sent;
@@ -15,10 +15,14 @@
 #include <hpx/runtime/serialization/serialization_fwd.hpp>
 #include <hpx/runtime/serialization/map.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/always_void.hpp>
 #include <hpx/util/assert.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -28,6 +32,34 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace parcelset
 {
+    namespace detail
+    {
+        // Locality implementations may provide a hash_value() function
+        // (found by ADL), otherwise the hash is computed from their printed
+        // representation.
+        template <typename Impl, typename Enable = void>
+        struct locality_hash
+        {
+            std::size_t operator()(Impl const& impl) const
+            {
+                std::ostringstream strm;
+                strm << impl;
+                return std::hash<std::string>()(strm.str());
+            }
+        };
+
+        template <typename Impl>
+        struct locality_hash<Impl,
+            typename util::always_void<decltype(
+                hash_value(std::declval<Impl const&>()))>::type>
+        {
+            std::size_t operator()(Impl const& impl) const
+            {
+                return hash_value(impl);
+            }
+        };
+    }
+
     class HPX_EXPORT locality
     {
         template <typename Impl>
@@ -41,6 +73,7 @@ namespace hpx { namespace parcelset
             virtual bool equal(impl_base const & rhs) const = 0;
             virtual bool less_than(impl_base const & rhs) const = 0;
             virtual bool valid() const = 0;
+            virtual std::size_t hash() const = 0;
             virtual const char *type() const = 0;
             virtual std::ostream & print(std::ostream & os) const = 0;
             virtual void save(serialization::output_archive & ar) const = 0;
@@ -130,6 +163,12 @@ namespace hpx { namespace parcelset
             return impl_ ? impl_->type() : "";
         }
 
+        // equal localities have equal hash values
+        std::size_t hash() const
+        {
+            return impl_ ? impl_->hash() : 0;
+        }
+
         template <typename Impl>
         Impl & get()
         {
@@ -212,6 +251,11 @@ namespace hpx { namespace parcelset
                 return !!impl_;
             }
 
+            std::size_t hash() const
+            {
+                return detail::locality_hash<Impl>()(impl_);
+            }
+
             const char *type() const
             {
                 return Impl::type();
@@ -155,6 +155,12 @@ namespace hpx { namespace parcelset
 
         std::size_t & size();
 
+        // the time the parcel was handed to the parcelport for sending
+        // (nanoseconds, zero if it was not recorded), this is not sent
+        std::int64_t enqueue_time() const;
+
+        void set_enqueue_time(std::int64_t time);
+
         void schedule_action(std::size_t num_thread = std::size_t(-1));
 
         // returns true if parcel was migrated, false if scheduled locally
@@ -182,6 +188,7 @@ namespace hpx { namespace parcelset
         split_gids_type split_gids_;
         std::size_t size_;
         std::size_t num_chunks_;
+        std::int64_t enqueue_time_;
     };
 
     HPX_EXPORT std::string dump_parcel(parcel const& p);
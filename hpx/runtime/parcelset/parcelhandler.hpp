@@ -286,6 +286,12 @@ namespace hpx { namespace parcelset
             use_alternative_parcelports_.store(false);
         }
 
+        /// Establish connections to all localities (or to the ones listed in
+        /// hpx.parcel.prewarm_connections) in parallel, waits for all of
+        /// them to be connected. This must be called from an HPX thread
+        /// after the bootstrap has finished.
+        void prewarm_connections();
+
         /// Return the reference to an existing io_service
         util::io_service_pool* get_thread_pool(char const* name);
 
@@ -396,6 +402,36 @@ namespace hpx { namespace parcelset
         std::int64_t get_connection_cache_statistics(std::string const& pp_type,
             parcelport::connection_cache_statistics_type stat_type, bool) const;
 
+        // statistics of the queues of parcels waiting to be sent
+        std::int64_t get_pending_parcels_contention(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_pending_parcels_destinations(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_pending_parcels_max_depth(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_pending_parcels_shards(
+            std::string const& pp_type, bool reset) const;
+
+        // statistics of the pool of receive buffers
+        std::int64_t get_receive_buffer_allocations(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_receive_buffer_reuses(
+            std::string const& pp_type, bool reset) const;
+
+        // number of bytes copied while growing send buffers
+        std::int64_t get_send_buffer_reallocated_bytes(
+            std::string const& pp_type, bool reset) const;
+
+        // statistics of the adaptive compression of outgoing messages
+        std::int64_t get_compressed_messages(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_compressed_raw_bytes(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_compressed_bytes(
+            std::string const& pp_type, bool reset) const;
+        std::int64_t get_compression_time(
+            std::string const& pp_type, bool reset) const;
+
         void list_parcelports(std::ostringstream& strm) const;
         void list_parcelport(std::ostringstream& strm,
             std::string const& ppname, int priority, bool bootstrap) const;
@@ -433,6 +469,12 @@ namespace hpx { namespace parcelset
 
         void register_counter_types(std::string const& pp_type);
         void register_connection_cache_counter_types(std::string const& pp_type);
+        void register_pending_parcels_counter_types(std::string const& pp_type);
+        void register_buffer_counter_types(std::string const& pp_type);
+        void register_adaptive_compression_counter_types(
+            std::string const& pp_type);
+        void register_latency_histogram_counter_types(
+            std::string const& pp_type);
 
     private:
         int get_priority(std::string const& name) const
@@ -15,9 +15,13 @@
 #include <hpx/performance_counters/parcels/data_point.hpp>
 #include <hpx/performance_counters/parcels/gatherer.hpp>
 #include <hpx/runtime/applier_fwd.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histograms.hpp>
 #include <hpx/runtime/parcelset/detail/per_action_data_counter.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcel.hpp>
+#include <hpx/util/buffer_pool.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
 #include <hpx/util/function.hpp>
 #include <hpx/util/tuple.hpp>
 #include <hpx/util_fwd.hpp>
@@ -158,6 +162,16 @@ namespace hpx { namespace parcelset
         /// Cache specific functionality
         virtual void remove_from_connection_cache(locality const& loc) = 0;
 
+        /// Establish a connection to the given locality and keep it in the
+        /// connection cache, it will not be evicted to make space for
+        /// connections to other localities.
+        ///
+        /// \returns true if the connection was established.
+        virtual bool prewarm_connection(locality const& loc, error_code& ec)
+        {
+            return false;
+        }
+
         /// Return the thread pool if the name matches
         virtual util::io_service_pool* get_thread_pool(char const* name) = 0;
 
@@ -168,7 +182,8 @@ namespace hpx { namespace parcelset
             connection_cache_evictions = 1,
             connection_cache_hits = 2,
             connection_cache_misses = 3,
-            connection_cache_reclaims = 4
+            connection_cache_reclaims = 4,
+            connection_cache_reconnects = 5
         };
 
         // invoke pending background work
@@ -178,6 +193,13 @@ namespace hpx { namespace parcelset
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// The connections used for sending the parcels of the priority lane
+        /// are taken from the overall number of connections a parcelport may
+        /// use (hpx.parcel.<type>.max_connections). Return the number of
+        /// connections reserved for the priority lane.
+        static std::size_t get_max_priority_connections(
+            std::size_t max_connections, bool use_priority_lanes);
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -243,6 +265,48 @@ namespace hpx { namespace parcelset
 
         std::int64_t get_pending_parcels_count(bool /*reset*/);
 
+        /// number of times enqueueing a parcel had to wait for the lock
+        /// protecting the pending parcels of its destination
+        std::int64_t get_pending_parcels_contention(bool reset);
+
+        /// the number of destinations which currently have pending parcels
+        std::int64_t get_pending_parcels_destinations(bool /*reset*/);
+
+        /// the largest number of parcels currently pending for a single
+        /// destination
+        std::int64_t get_pending_parcels_max_depth(bool /*reset*/);
+
+        /// the number of shards which currently have pending parcels
+        std::int64_t get_pending_parcels_shards(bool /*reset*/);
+
+        /// number of receive buffers which had to be newly allocated
+        std::int64_t get_receive_buffer_allocations(bool reset);
+
+        /// number of receive buffers which were reused from the pool
+        std::int64_t get_receive_buffer_reuses(bool reset);
+
+        /// number of bytes which had to be copied because a send buffer was
+        /// reallocated while encoding a message
+        std::int64_t get_send_buffer_reallocated_bytes(bool reset);
+
+        void add_send_buffer_reallocated_bytes(std::size_t bytes)
+        {
+            if (bytes != 0)
+                send_buffer_reallocated_bytes_ += std::int64_t(bytes);
+        }
+
+        /// number of messages compressed by the adaptive compression
+        std::int64_t get_compressed_messages(bool reset);
+
+        /// data compressed by the adaptive compression, before and after
+        /// compression (bytes)
+        std::int64_t get_compressed_raw_bytes(bool reset);
+        std::int64_t get_compressed_bytes(bool reset);
+
+        /// the total time it took to encode the messages compressed by the
+        /// adaptive compression (nanoseconds)
+        std::int64_t get_compression_time(bool reset);
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
         // same as above, just separated data for each action
         // number of parcels sent
@@ -316,6 +380,33 @@ namespace hpx { namespace parcelset
             return allow_zero_copy_optimizations_;
         }
 
+        /// Return the minimal size of a chunk of data to be sent without
+        /// copying it into the main message buffer
+        std::size_t zero_copy_serialization_threshold() const
+        {
+            return zero_copy_serialization_threshold_;
+        }
+
+        /// Return the pool of buffers used to receive zero-copy chunks,
+        /// received data may keep referring to those buffers after decoding
+        util::buffer_pool<char>& get_receive_buffer_pool()
+        {
+            return *receive_buffer_pool_;
+        }
+
+        /// Return the policy choosing the compression of outgoing messages
+        /// which are not compressed by their actions
+        detail::adaptive_compression& get_adaptive_compression()
+        {
+            return adaptive_compression_;
+        }
+
+        /// Return the histograms of the latencies of this parcelport
+        detail::latency_histograms& get_latency_histograms()
+        {
+            return latency_histograms_;
+        }
+
         bool async_serialization() const
         {
             return async_serialization_;
@@ -337,11 +428,95 @@ namespace hpx { namespace parcelset
           , std::vector<write_handler_type>
         > map_second_type;
         typedef std::map<locality, map_second_type> pending_parcels_map;
-        pending_parcels_map pending_parcels_;
-
         typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
-        std::atomic<std::uint32_t> num_parcel_destinations_;
+
+        /// Parcels of actions with a high priority are queued in their own
+        /// lane. They are never encoded into the same message as normal
+        /// parcels and are sent over separate connections, so they don't
+        /// have to wait for large transfers to the same destination.
+        enum parcel_lane
+        {
+            parcel_lane_normal = 0,
+            parcel_lane_priority = 1,
+            num_parcel_lanes = 2
+        };
+
+        /// Return the lane the given parcel has to be queued in
+        parcel_lane get_parcel_lane(parcel const& p) const;
+
+        /// The pending parcels are distributed over several shards (selected
+        /// by the hash of the destination), each of which is protected by
+        /// its own lock. Threads sending parcels to different destinations
+        /// will therefore rarely contend for the same lock.
+        struct pending_parcels_shard
+        {
+            pending_parcels_shard()
+              : active_(false)
+            {}
+
+            lcos::local::spinlock mtx_;
+            pending_parcels_map pending_parcels_[num_parcel_lanes];
+            pending_parcels_destinations parcel_destinations_[num_parcel_lanes];
+
+            // the shard has destinations with pending parcels, this may be
+            // read without holding the lock
+            std::atomic<bool> active_;
+        };
+
+        /// Add or remove a destination with pending parcels, the shard of
+        /// the destination has to be locked. This keeps track of the number
+        /// of shards which have pending parcels.
+        void add_pending_destination(pending_parcels_shard& shard,
+            parcel_lane lane, locality const& loc)
+        {
+            if (shard.parcel_destinations_[lane].insert(loc).second &&
+                !shard.active_.load(std::memory_order_relaxed))
+            {
+                shard.active_.store(true, std::memory_order_relaxed);
+                ++num_active_pending_shards_;
+            }
+        }
+
+        void remove_pending_destination(pending_parcels_shard& shard,
+            parcel_lane lane, locality const& loc)
+        {
+            if (shard.parcel_destinations_[lane].erase(loc) != 0 &&
+                shard.parcel_destinations_[parcel_lane_normal].empty() &&
+                shard.parcel_destinations_[parcel_lane_priority].empty())
+            {
+                HPX_ASSERT(shard.active_.load(std::memory_order_relaxed));
+                shard.active_.store(false, std::memory_order_relaxed);
+
+                HPX_ASSERT(0 != num_active_pending_shards_.load());
+                --num_active_pending_shards_;
+            }
+        }
+
+        pending_parcels_shard& get_pending_parcels_shard(locality const& loc)
+        {
+            return pending_parcels_shards_[
+                loc.hash() % pending_parcels_shards_.size()].data_;
+        }
+
+        std::vector<util::cache_aligned_data<pending_parcels_shard>>
+            pending_parcels_shards_;
+        std::atomic<std::size_t> num_active_pending_shards_;
+
+        /// Number of times a thread had to wait for the lock of a shard
+        /// while enqueueing parcels
+        std::atomic<std::int64_t> pending_parcels_contention_;
+
+        /// Size-classed pool of buffers for received zero-copy chunks
+        std::shared_ptr<util::buffer_pool<char> > receive_buffer_pool_;
+
+        /// Bytes copied while growing send buffers during encoding
+        std::atomic<std::int64_t> send_buffer_reallocated_bytes_;
+
+        /// Compression policy for outgoing messages
+        detail::adaptive_compression adaptive_compression_;
+
+        /// Latency histograms, collected only if requested by a counter
+        detail::latency_histograms latency_histograms_;
 
         /// The local locality
         locality here_;
@@ -363,10 +538,14 @@ namespace hpx { namespace parcelset
         /// serialization is allowed to use array optimization
         bool allow_array_optimizations_;
         bool allow_zero_copy_optimizations_;
+        std::size_t zero_copy_serialization_threshold_;
 
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// parcels of high priority actions are sent using their own lane
+        bool use_priority_lanes_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
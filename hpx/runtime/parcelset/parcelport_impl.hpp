@@ -25,12 +25,14 @@
 #include <hpx/util/connection_cache.hpp>
 #include <hpx/util/deferred_call.hpp>
 #include <hpx/util/detail/yield_k.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/io_service_pool.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
 
 #include <boost/predef/other/endian.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -102,6 +104,48 @@ namespace hpx { namespace parcelset
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        // both lanes share the configured maximal number of connections
+        static std::size_t max_priority_connections(
+            util::runtime_configuration const& ini)
+        {
+            return get_max_priority_connections(max_connections(ini),
+                hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.priority_lanes", "1") != 0);
+        }
+
+        static std::size_t max_normal_connections(
+            util::runtime_configuration const& ini)
+        {
+            std::size_t max_conn = max_connections(ini);
+            std::size_t priority_conn = max_priority_connections(ini);
+
+            // there has to be room for the connections to one locality
+            return (std::max)(
+                max_conn > priority_conn ? max_conn - priority_conn : 0,
+                max_connections_per_loc(ini));
+        }
+
+        static util::connection_cache_policy connection_cache_policy(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            std::string policy = ini.get_entry(
+                key + ".connection_cache_policy", "lru");
+            if (policy == "lfu")
+                return util::connection_cache_lfu;
+
+            if (policy != "lru")
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "parcelport_impl::connection_cache_policy",
+                    "invalid connection cache policy '" + policy +
+                    "', expected 'lru' or 'lfu'");
+            }
+            return util::connection_cache_lru;
+        }
+
     public:
         /// Construct the parcelport on the given locality.
         parcelport_impl(util::runtime_configuration const& ini,
@@ -113,8 +157,10 @@ namespace hpx { namespace parcelset
           : parcelport(ini, here, connection_handler_type())
           , io_service_pool_(thread_pool_size(ini), on_start_thread,
                 on_stop_thread, pool_name(), pool_name_postfix())
-          , connection_cache_(
-                max_connections(ini), max_connections_per_loc(ini))
+          , connection_cache_(max_normal_connections(ini),
+                max_connections_per_loc(ini), connection_cache_policy(ini))
+          , priority_connection_cache_(max_priority_connections(ini), 2,
+                connection_cache_policy(ini))
           , archive_flags_(0)
           , operations_in_flight_(0)
           , num_thread_(0)
@@ -143,11 +189,15 @@ namespace hpx { namespace parcelset
                 if (!this->allow_zero_copy_optimizations())
                     archive_flags_ |= serialization::disable_data_chunking;
             }
+
+            // all localities agree on the ids of the polymorphic types
+            archive_flags_ |= serialization::enable_type_ids;
         }
 
         ~parcelport_impl() override
         {
             connection_cache_.clear();
+            priority_connection_cache_.clear();
         }
 
         bool can_bootstrap() const override
@@ -198,11 +248,13 @@ namespace hpx { namespace parcelset
 
             if (blocking) {
                 connection_cache_.shutdown();
+                priority_connection_cache_.shutdown();
                 connection_handler().do_stop();
                 io_service_pool_.wait();
                 io_service_pool_.stop();
                 io_service_pool_.join();
                 connection_cache_.clear();
+                priority_connection_cache_.clear();
                 io_service_pool_.clear();
             }
             else
@@ -217,6 +269,12 @@ namespace hpx { namespace parcelset
         {
             HPX_ASSERT(dest.type() == type());
 
+            // remember when the parcel was handed to us
+            if (latency_histograms_.enabled(detail::latency_enqueue_to_send))
+            {
+                p.set_enqueue_time(util::high_resolution_clock::now());
+            }
+
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
             // or GIDs to be split. This is necessary to preserve the identity
@@ -234,9 +292,10 @@ namespace hpx { namespace parcelset
                     else
                     {
                         // enqueue the outgoing parcel ...
-                        enqueue_parcel(dest, std::move(p), std::move(f));
+                        parcel_lane lane = get_parcel_lane(p);
+                        enqueue_parcel(dest, lane, std::move(p), std::move(f));
 
-                        get_connection_and_send_parcels(dest);
+                        get_connection_and_send_parcels(dest, lane);
                     }
                 });
         }
@@ -260,6 +319,14 @@ namespace hpx { namespace parcelset
                     parcels[i].destination_locality());
             }
 #endif
+            // remember when the parcels were handed to us
+            if (latency_histograms_.enabled(detail::latency_enqueue_to_send))
+            {
+                std::int64_t now = util::high_resolution_clock::now();
+                for (parcel& p : parcels)
+                    p.set_enqueue_time(now);
+            }
+
             // We create a shared pointer of the parcels_await object since it
             // needs to be kept alive as long as there are futures not ready
             // or GIDs to be split. This is necessary to preserve the identity
@@ -279,10 +346,20 @@ namespace hpx { namespace parcelset
                     }
                     else
                     {
-                        enqueue_parcels(
+                        // high priority parcels go out first
+                        std::size_t lanes = enqueue_parcels(
                             dest, std::move(parcels), std::move(handlers));
 
-                        get_connection_and_send_parcels(dest);
+                        if (lanes & (std::size_t(1) << parcel_lane_priority))
+                        {
+                            get_connection_and_send_parcels(
+                                dest, parcel_lane_priority);
+                        }
+                        if (lanes & (std::size_t(1) << parcel_lane_normal))
+                        {
+                            get_connection_and_send_parcels(
+                                dest, parcel_lane_normal);
+                        }
                     }
                 });
         }
@@ -338,6 +415,7 @@ namespace hpx { namespace parcelset
             }
 
             connection_cache_.clear(loc);
+            priority_connection_cache_.clear(loc);
         }
 
         void remove_from_connection_cache(locality const& loc) override
@@ -361,6 +439,36 @@ namespace hpx { namespace parcelset
                 threads::thread_priority_boost, true, ec);
         }
 
+        bool prewarm_connection(locality const& loc, error_code& ec) override
+        {
+            if (connection_handler_traits<ConnectionHandler>::
+                    send_immediate_parcels::value)
+            {
+                return false;
+            }
+
+            std::shared_ptr<connection> sender_connection;
+            if (!connection_cache_.get_or_reserve(loc, sender_connection))
+                return false;
+
+            if (!sender_connection)
+            {
+                sender_connection =
+                    connection_handler().create_connection(loc, ec);
+                if (!sender_connection)
+                {
+                    // give up the reserved slot
+                    connection_cache_.clear(loc);
+                    return false;
+                }
+            }
+
+            connection_cache_.reclaim(loc, sender_connection);
+            connection_cache_.pin(loc);
+
+            return true;
+        }
+
         /// Return the name of this locality
         std::string get_locality_name() const override
         {
@@ -388,6 +496,10 @@ namespace hpx { namespace parcelset
                 case connection_cache_reclaims:
                     return connection_cache_.get_cache_reclaims(reset);
 
+                case connection_cache_reconnects:
+                    return connection_cache_.get_cache_reconnects(reset) +
+                        priority_connection_cache_.get_cache_reconnects(reset);
+
                 default:
                     break;
             }
@@ -514,7 +626,10 @@ namespace hpx { namespace parcelset
                     HPX_ASSERT(ps == nullptr);
                     HPX_ASSERT(num_parcels == 0u);
 
-                    if(!dequeue_parcels(dest_, parcels, handlers))
+                    if(!dequeue_parcels(dest_, parcel_lane_priority,
+                            parcels, handlers) &&
+                        !dequeue_parcels(dest_, parcel_lane_normal,
+                            parcels, handlers))
                     {
                         // Give this connection back to the connection handler as
                         // we couldn't dequeue parcels.
@@ -582,8 +697,15 @@ namespace hpx { namespace parcelset
 
     private:
         ///////////////////////////////////////////////////////////////////////
+        util::connection_cache<connection, locality>& get_connection_cache(
+            parcel_lane lane)
+        {
+            return lane == parcel_lane_priority ?
+                priority_connection_cache_ : connection_cache_;
+        }
+
         std::shared_ptr<connection> get_connection(
-            locality const& l, bool force, error_code& ec)
+            locality const& l, parcel_lane lane, bool force, error_code& ec)
         {
             // Request new connection from connection cache.
             std::shared_ptr<connection> sender_connection;
@@ -595,7 +717,8 @@ namespace hpx { namespace parcelset
             }
             else {
                 // Get a connection or reserve space for a new connection.
-                if (!connection_cache_.get_or_reserve(l, sender_connection))
+                if (!get_connection_cache(lane).get_or_reserve(
+                        l, sender_connection))
                 {
                     // If no slot is available it's not a problem as the parcel
                     // will be sent out whenever the next connection is returned
@@ -617,12 +740,30 @@ namespace hpx { namespace parcelset
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void enqueue_parcel(locality const& locality_id,
+        // acquire the lock of the given shard, keep track of how often
+        // this had to wait for another thread
+        void lock_pending_parcels_shard(
+            std::unique_lock<lcos::local::spinlock>& l)
+        {
+            if (!l.try_lock())
+            {
+                ++pending_parcels_contention_;
+                l.lock();
+            }
+        }
+
+        void enqueue_parcel(locality const& locality_id, parcel_lane lane,
             parcel&& p, write_handler_type&& f)
         {
             typedef pending_parcels_map::mapped_type mapped_type;
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+
+            std::unique_lock<lcos::local::spinlock> l(shard.mtx_,
+                std::defer_lock);
+            lock_pending_parcels_shard(l);
+
             // We ignore the lock here. It might happen that while enqueuing,
             // we need to acquire a lock. This should not cause any problems
             // (famous last words)
@@ -630,21 +771,79 @@ namespace hpx { namespace parcelset
                 std::unique_lock<lcos::local::spinlock>
             > il(&l);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = shard.pending_parcels_[lane][locality_id];
             util::get<0>(e).push_back(std::move(p));
             util::get<1>(e).push_back(std::move(f));
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            add_pending_destination(shard, lane, locality_id);
+        }
+
+        // Distribute the given parcels over the lanes they belong to,
+        // returns the set of lanes which received parcels (as a bit mask).
+        std::size_t enqueue_parcels(locality const& locality_id,
+            std::vector<parcel>&& parcels,
+            std::vector<write_handler_type>&& handlers)
+        {
+            HPX_ASSERT(parcels.size() == handlers.size());
+
+            std::size_t priority_parcels = 0;
+            for (parcel const& p : parcels)
+            {
+                if (get_parcel_lane(p) == parcel_lane_priority)
+                    ++priority_parcels;
+            }
+
+            // all parcels belong to the same lane (the common case)
+            if (priority_parcels == 0 || priority_parcels == parcels.size())
+            {
+                parcel_lane lane = priority_parcels == 0 ?
+                    parcel_lane_normal : parcel_lane_priority;
+                enqueue_parcels(locality_id, lane, std::move(parcels),
+                    std::move(handlers));
+                return std::size_t(1) << lane;
+            }
+
+            std::vector<parcel> lane_parcels[num_parcel_lanes];
+            std::vector<write_handler_type> lane_handlers[num_parcel_lanes];
+
+            lane_parcels[parcel_lane_priority].reserve(priority_parcels);
+            lane_handlers[parcel_lane_priority].reserve(priority_parcels);
+            lane_parcels[parcel_lane_normal].reserve(
+                parcels.size() - priority_parcels);
+            lane_handlers[parcel_lane_normal].reserve(
+                parcels.size() - priority_parcels);
+
+            for (std::size_t i = 0; i != parcels.size(); ++i)
+            {
+                parcel_lane lane = get_parcel_lane(parcels[i]);
+                lane_parcels[lane].push_back(std::move(parcels[i]));
+                lane_handlers[lane].push_back(std::move(handlers[i]));
+            }
+
+            enqueue_parcels(locality_id, parcel_lane_priority,
+                std::move(lane_parcels[parcel_lane_priority]),
+                std::move(lane_handlers[parcel_lane_priority]));
+            enqueue_parcels(locality_id, parcel_lane_normal,
+                std::move(lane_parcels[parcel_lane_normal]),
+                std::move(lane_handlers[parcel_lane_normal]));
+
+            return (std::size_t(1) << parcel_lane_priority) |
+                (std::size_t(1) << parcel_lane_normal);
         }
 
-        void enqueue_parcels(locality const& locality_id,
+        void enqueue_parcels(locality const& locality_id, parcel_lane lane,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
             typedef pending_parcels_map::mapped_type mapped_type;
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+
+            std::unique_lock<lcos::local::spinlock> l(shard.mtx_,
+                std::defer_lock);
+            lock_pending_parcels_shard(l);
+
             // We ignore the lock here. It might happen that while enqueuing,
             // we need to acquire a lock. This should not cause any problems
             // (famous last words)
@@ -654,7 +853,7 @@ namespace hpx { namespace parcelset
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
+            mapped_type& e = shard.pending_parcels_[lane][locality_id];
             if (util::get<0>(e).empty())
             {
                 HPX_ASSERT(util::get<1>(e).empty());
@@ -674,26 +873,31 @@ namespace hpx { namespace parcelset
                     std::back_inserter(util::get<1>(e)));
             }
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            add_pending_destination(shard, lane, locality_id);
         }
 
-        bool dequeue_parcels(locality const& locality_id,
+        bool dequeue_parcels(locality const& locality_id, parcel_lane lane,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
             typedef pending_parcels_map::iterator iterator;
 
+            pending_parcels_shard& shard =
+                get_pending_parcels_shard(locality_id);
+
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                std::unique_lock<lcos::local::spinlock> l(
+                    shard.mtx_, std::try_to_lock);
 
                 if (!l) return false;
 
-                iterator it = pending_parcels_.find(locality_id);
+                pending_parcels_map& pending = shard.pending_parcels_[lane];
+                iterator it = pending.find(locality_id);
 
                 // do nothing if parcels have already been picked up by
                 // another thread
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
+                if (it != pending.end() &&
+                    !util::get<0>(it->second).empty())
                 {
                     HPX_ASSERT(it->first == locality_id);
                     HPX_ASSERT(handlers.size() == 0);
@@ -707,15 +911,14 @@ namespace hpx { namespace parcelset
                 }
                 else
                 {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
+                    HPX_ASSERT(it == pending.end() ||
+                        util::get<1>(it->second).empty());
+                    HPX_ASSERT(shard.parcel_destinations_[lane].find(
+                        locality_id) == shard.parcel_destinations_[lane].end());
                     return false;
                 }
 
-                parcel_destinations_.erase(locality_id);
-
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
-
+                remove_pending_destination(shard, lane, locality_id);
                 return true;
             }
         }
@@ -723,28 +926,48 @@ namespace hpx { namespace parcelset
     protected:
         bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
         {
+            if (0 == num_active_pending_shards_.load(
+                    std::memory_order_relaxed))
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                return false;
+            }
 
-                if (!l) return false;
+            for (auto& s : pending_parcels_shards_)
+            {
+                pending_parcels_shard& shard = s.data_;
+                if (!shard.active_.load(std::memory_order_relaxed))
+                    continue;
+
+                std::unique_lock<lcos::local::spinlock> l(
+                    shard.mtx_, std::try_to_lock);
 
-                for (auto &pending: pending_parcels_)
+                if (!l) continue;
+
+                // serve the priority lane first
+                for (int lane = num_parcel_lanes - 1; lane >= 0; --lane)
                 {
-                    auto &parcels = util::get<0>(pending.second);
-                    if (!parcels.empty())
+                    pending_parcels_map& lane_parcels =
+                        shard.pending_parcels_[lane];
+                    for (auto &pending: lane_parcels)
                     {
-                        auto& handlers = util::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
+                        auto &parcels = util::get<0>(pending.second);
+                        if (!parcels.empty())
                         {
-                            pending_parcels_.erase(dest);
+                            auto& handlers = util::get<1>(pending.second);
+                            dest = pending.first;
+                            p = std::move(parcels.back());
+                            parcels.pop_back();
+                            handler = std::move(handlers.back());
+                            handlers.pop_back();
+
+                            if (parcels.empty())
+                            {
+                                lane_parcels.erase(dest);
+                                remove_pending_destination(shard,
+                                    static_cast<parcel_lane>(lane), dest);
+                            }
+                            return true;
                         }
-                        return true;
                     }
                 }
             }
@@ -753,31 +976,49 @@ namespace hpx { namespace parcelset
 
         bool trigger_pending_work()
         {
-            if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
+            // nothing to do if no shard has pending parcels, this is the
+            // common case while idling
+            if (0 == num_active_pending_shards_.load(
+                    std::memory_order_relaxed))
+            {
                 return true;
+            }
 
-            std::vector<locality> destinations;
+            std::vector<locality> destinations[num_parcel_lanes];
 
+            for (auto& s : pending_parcels_shards_)
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                pending_parcels_shard& shard = s.data_;
+
+                // skip shards without pending parcels without touching
+                // their lock
+                if (!shard.active_.load(std::memory_order_relaxed))
+                    continue;
+
+                std::unique_lock<lcos::local::spinlock> l(
+                    shard.mtx_, std::try_to_lock);
                 if(l.owns_lock())
                 {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
+                    for (int lane = 0; lane != num_parcel_lanes; ++lane)
                     {
-                        destinations.push_back(loc);
+                        for (locality const& loc :
+                            shard.parcel_destinations_[lane])
+                        {
+                            destinations[lane].push_back(loc);
+                        }
                     }
                 }
             }
 
             // Create new HPX threads which send the parcels that are still
-            // pending.
-            for (locality const& loc : destinations)
+            // pending, high priority parcels go out first.
+            for (locality const& loc : destinations[parcel_lane_priority])
             {
-                get_connection_and_send_parcels(loc);
+                get_connection_and_send_parcels(loc, parcel_lane_priority);
+            }
+            for (locality const& loc : destinations[parcel_lane_normal])
+            {
+                get_connection_and_send_parcels(loc, parcel_lane_normal);
             }
 
             return true;
@@ -786,7 +1027,8 @@ namespace hpx { namespace parcelset
     private:
         ///////////////////////////////////////////////////////////////////////
         void get_connection_and_send_parcels(
-            locality const& locality_id, bool background = false)
+            locality const& locality_id, parcel_lane lane,
+            bool background = false)
         {
 
             if (connection_handler_traits<ConnectionHandler>::
@@ -803,7 +1045,7 @@ namespace hpx { namespace parcelset
 
             error_code ec;
             std::shared_ptr<connection> sender_connection =
-                get_connection(locality_id, force_connection, ec);
+                get_connection(locality_id, lane, force_connection, ec);
 
             if (!sender_connection)
             {
@@ -818,18 +1060,19 @@ namespace hpx { namespace parcelset
             std::vector<parcel> parcels;
             std::vector<write_handler_type> handlers;
 
-            if(!dequeue_parcels(locality_id, parcels, handlers))
+            if(!dequeue_parcels(locality_id, lane, parcels, handlers))
             {
                 // Give this connection back to the cache as we couldn't dequeue
                 // parcels.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                get_connection_cache(lane).reclaim(
+                    locality_id, sender_connection);
 
                 return;
             }
 
             // send parcels if they didn't get sent by another connection
             send_pending_parcels(
-                locality_id,
+                locality_id, lane,
                 sender_connection, std::move(parcels),
                 std::move(handlers));
 
@@ -841,7 +1084,7 @@ namespace hpx { namespace parcelset
         }
 
 
-        void send_pending_parcels_trampoline(
+        void send_pending_parcels_trampoline(parcel_lane lane,
             boost::system::error_code const& ec,
             locality const& locality_id,
             std::shared_ptr<connection> sender_connection)
@@ -856,29 +1099,37 @@ namespace hpx { namespace parcelset
             {
                 // Give this connection back to the cache as it's not
                 // needed anymore.
-                connection_cache_.reclaim(locality_id, sender_connection);
+                get_connection_cache(lane).reclaim(
+                    locality_id, sender_connection);
             }
             else
             {
                 // remove this connection from cache
-                connection_cache_.clear(locality_id, sender_connection);
+                get_connection_cache(lane).clear(
+                    locality_id, sender_connection);
             }
             {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
+                pending_parcels_shard& shard =
+                    get_pending_parcels_shard(locality_id);
+
+                std::lock_guard<lcos::local::spinlock> l(shard.mtx_);
 
 //                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
+                pending_parcels_map& pending = shard.pending_parcels_[lane];
+                pending_parcels_map::iterator it = pending.find(locality_id);
+                if (it == pending.end() || util::get<0>(it->second).empty())
+                {
                     return;
+                }
             }
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
-            get_connection_and_send_parcels(locality_id);
+            get_connection_and_send_parcels(locality_id, lane);
         }
 
         void send_pending_parcels(
-            parcelset::locality const & parcel_locality_id,
+            parcelset::locality const & parcel_locality_id, parcel_lane lane,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
@@ -906,7 +1157,7 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, lane));
             }
             else
             {
@@ -930,13 +1181,13 @@ namespace hpx { namespace parcelset
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
                     util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                        this, lane));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
-                enqueue_parcels(parcel_locality_id, std::move(parcels),
+                enqueue_parcels(parcel_locality_id, lane, std::move(parcels),
                     std::move(handlers));
             }
 
@@ -961,6 +1212,9 @@ namespace hpx { namespace parcelset
         /// The connection cache for sending connections
         util::connection_cache<connection, locality> connection_cache_;
 
+        /// The connections used for sending parcels of the priority lane
+        util::connection_cache<connection, locality> priority_connection_cache_;
+
         typedef hpx::lcos::local::spinlock mutex_type;
 
         int archive_flags_;
@@ -218,6 +218,12 @@ namespace hpx { namespace serialization
         };
 
     public:
+        // whether T has a (possibly private) serialize member function
+        template <class T>
+        struct has_intrusive_serialize
+          : std::integral_constant<bool, has_serialize<T>::value>
+        {};
+
         template <class Archive, class T>
         static void serialize(Archive& ar, T& t, unsigned)
         {
@@ -247,6 +253,48 @@ namespace hpx { namespace serialization
         }
     };
 
-}}
+    ///////////////////////////////////////////////////////////////////////////
+    // whether T provides a serialize function (member or free) of its own
+    template <typename T>
+    struct has_serialize_function
+      : std::integral_constant<bool,
+            access::has_intrusive_serialize<T>::value ||
+            has_serialize_adl<T>::value>
+    {};
+
+    // whether T is a simple struct which is serialized member by member using
+    // serialize_struct, this depends on the shape of T only
+#if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) && \
+    defined(HPX_HAVE_CXX17_IF_CONSTEXPR)
+    template <typename T>
+    class is_struct_serializable
+    {
+        template <typename T1> static std::false_type test(...);
+
+        template <typename T1, typename = decltype(
+            hpx::traits::detail::arity<T1>())>
+        static std::true_type test(int);
 
+    public:
+        static constexpr bool value = decltype(test<T>(0))::value;
+    };
+#else
+    template <typename T>
+    struct is_struct_serializable
+      : std::false_type
+    {};
 #endif
+
+    // whether the class T can be serialized member by member, bitwise
+    // serializable types fall back to this if they can't be copied as a whole
+    template <typename T>
+    struct is_serializable_per_member
+      : std::integral_constant<bool,
+            std::is_class<T>::value && (
+                std::is_empty<T>::value ||
+                has_serialize_function<T>::value ||
+                is_struct_serializable<T>::value)>
+    {};
+}}
+
+#endif
\ No newline at end of file
@@ -34,7 +34,8 @@ namespace hpx { namespace serialization
         endian_little               = 0x00008000,
         disable_array_optimization  = 0x00010000,
         disable_data_chunking       = 0x00020000,
-        all_archive_flags           = 0x0003e000    // all of the above
+        enable_type_ids             = 0x00040000,
+        all_archive_flags           = 0x0007e000    // all of the above
     };
 
     void HPX_FORCEINLINE
@@ -94,6 +95,12 @@ namespace hpx { namespace serialization
                 true : false;
         }
 
+        bool enable_type_ids() const
+        {
+            return (flags_ & hpx::serialization::enable_type_ids) ?
+                true : false;
+        }
+
         std::uint32_t flags() const
         {
             return flags_;
@@ -25,6 +25,13 @@ namespace hpx { namespace serialization
         virtual bool flush(void* dst, std::size_t dst_count,
             std::size_t& written) = 0;
 
+        // Return the number of bytes flush() needs at most after the given
+        // number of bytes were saved (zero if unknown)
+        virtual std::size_t get_max_flush_length(std::size_t size) const
+        {
+            return 0;
+        }
+
         // decompression API
         virtual std::size_t init_data(char const* buffer,
             std::size_t size, std::size_t buffer_size) = 0;
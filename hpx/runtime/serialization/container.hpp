@@ -15,6 +15,7 @@
 #include <hpx/util/assert.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization
 {
@@ -36,6 +37,10 @@ namespace hpx { namespace serialization
         virtual void reset() = 0;
         virtual std::size_t get_num_chunks() const = 0;
         virtual void flush() = 0;
+
+        // number of bytes which had to be moved as the container grew
+        // beyond its capacity
+        virtual std::size_t get_reallocated_bytes() const { return 0; }
     };
 
     struct erased_input_container
@@ -46,6 +51,16 @@ namespace hpx { namespace serialization
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void * address, std::size_t count) = 0;
         virtual void load_binary_chunk(void * address, std::size_t count) = 0;
+
+        // Hand out the memory of the next zero-copy chunk instead of copying
+        // it, if the chunk is of the given size and alignment and its memory
+        // can be shared (see input_archive::adopt_binary_chunk).
+        virtual bool adopt_binary_chunk(std::size_t count,
+            std::size_t alignment, void*& address,
+            std::shared_ptr<void>& owner)
+        {
+            return false;
+        }
     };
 }}
 
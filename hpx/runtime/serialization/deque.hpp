@@ -6,34 +6,134 @@
 #ifndef HPX_SERIALIZATION_DEQUE_HPP
 #define HPX_SERIALIZATION_DEQUE_HPP
 
+#include <hpx/config.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/detail/serialize_collection.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 
+#include <boost/predef/other/endian.h>
+
+#include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <type_traits>
 
 namespace hpx { namespace serialization
 {
+    namespace detail
+    {
+        // A deque stores its elements in blocks of contiguous memory, call
+        // the given function for each of those.
+        template <typename Iterator, typename F>
+        void for_each_deque_block(Iterator first, Iterator last, F const& f)
+        {
+            while (first != last)
+            {
+                auto* block = &*first;
+                std::size_t count = 1;
+                for (++first; first != last && &*first == block + count; ++first)
+                    ++count;
+
+                f(block, count);
+            }
+        }
+
+        template <typename Archive>
+        bool use_deque_blocks(Archive& ar)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            return !ar.disable_array_optimization() &&
+                !archive_endianess_differs;
+        }
+
+        // load deque<T>
+        template <typename T, typename Allocator>
+        void load_impl(input_archive & ar, std::deque<T, Allocator> & d,
+            std::uint64_t size, std::false_type)
+        {
+            // normal load ...
+            detail::load_collection(ar, d, size);
+        }
+
+        template <typename T, typename Allocator>
+        void load_impl(input_archive & ar, std::deque<T, Allocator> & d,
+            std::uint64_t size, std::true_type)
+        {
+            if (!use_deque_blocks(ar))
+            {
+                load_impl(ar, d, size, std::false_type());
+                return;
+            }
+
+            // bitwise load, block by block ...
+            d.resize(size);
+            for_each_deque_block(d.begin(), d.end(),
+                [&ar](T* block, std::size_t count)
+                {
+                    load_binary(ar, block, count * sizeof(T));
+                });
+        }
+
+        // save deque<T>
+        template <typename T, typename Allocator>
+        void save_impl(output_archive & ar, const std::deque<T, Allocator> & d,
+            std::false_type)
+        {
+            // normal save ...
+            detail::save_collection(ar, d);
+        }
+
+        template <typename T, typename Allocator>
+        void save_impl(output_archive & ar, const std::deque<T, Allocator> & d,
+            std::true_type)
+        {
+            if (!use_deque_blocks(ar))
+            {
+                save_impl(ar, d, std::false_type());
+                return;
+            }
+
+            // bitwise save, block by block ...
+            for_each_deque_block(d.begin(), d.end(),
+                [&ar](T const* block, std::size_t count)
+                {
+                    save_binary(ar, block, count * sizeof(T));
+                });
+        }
+    }
+
     template <typename T, typename Allocator>
     void serialize(input_archive & ar, std::deque<T, Allocator> & d, unsigned)
     {
-        // normal load ...
+        typedef std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value> use_optimized;
+
         std::uint64_t size;
         ar >> size; //-V128
         if(size == 0) return;
 
-        detail::load_collection(ar, d, size);
+        detail::load_impl(ar, d, size, use_optimized());
     }
 
     template <typename T, typename Allocator>
     void serialize(output_archive & ar, const std::deque<T, Allocator> & d, unsigned)
     {
-        // normal save ...
+        typedef std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T>::type
+            >::value> use_optimized;
+
         std::uint64_t size = d.size();
         ar << size;
         if(d.empty()) return;
 
-        detail::save_collection(ar, d);
+        detail::save_impl(ar, d, use_optimized());
     }
 }}
 
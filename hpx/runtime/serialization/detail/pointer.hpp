@@ -68,11 +68,8 @@ namespace hpx { namespace serialization
             {
                 static Pointer call(input_archive& ar)
                 {
-                    std::string name;
-                    ar >> name;
-
                     Pointer t(polymorphic_intrusive_factory::instance().
-                        create<referred_type>(name));
+                        create<referred_type>(ar));
                     ar >> *t;
                     return t;
                 }
@@ -146,8 +143,8 @@ namespace hpx { namespace serialization
             {
                 static void call(output_archive& ar, const Pointer& ptr)
                 {
-                    const std::string name = access::get_name(ptr.get());
-                    ar << name;
+                    polymorphic_intrusive_factory::instance().save_name(
+                        ar, access::get_name(ptr.get()));
                     ar << *ptr;
                 }
             };
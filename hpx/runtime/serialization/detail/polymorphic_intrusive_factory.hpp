@@ -14,11 +14,18 @@
 #include <hpx/util/debug/demangle_helper.hpp>
 #include <hpx/util/jenkins_hash.hpp>
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace hpx { namespace serialization { namespace detail
 {
+    // Creates instances of classes registered by name. Locality 0 assigns
+    // ids to all classes it knows about during startup and sends the full
+    // table to all other localities (see big_boot_barrier), archives which
+    // have type ids enabled carry the id instead of the name of a class.
+    // Classes not known to locality 0 at startup are always sent by name.
     class polymorphic_intrusive_factory
     {
     public:
@@ -28,9 +35,14 @@ namespace hpx { namespace serialization { namespace detail
         typedef void* (*ctor_type) ();
         typedef std::unordered_map<std::string,
             ctor_type, hpx::util::jenkins_hash> ctor_map_type;
+        typedef std::unordered_map<std::string,
+            std::uint32_t, hpx::util::jenkins_hash> typename_to_id_type;
+        typedef std::vector<ctor_type> cache_type;
 
     public:
-        polymorphic_intrusive_factory() {}
+        HPX_STATIC_CONSTEXPR std::uint32_t invalid_id = ~0u;
+
+        polymorphic_intrusive_factory() : max_id_(0) {}
 
         HPX_EXPORT static polymorphic_intrusive_factory& instance();
 
@@ -44,8 +56,41 @@ namespace hpx { namespace serialization { namespace detail
             return static_cast<T*>(create(name));
         }
 
+        // Save the name of a registered class (or its id, if possible) and
+        // create an instance of the class saved this way.
+        HPX_EXPORT void save_name(
+            output_archive& ar, std::string const& name) const;
+
+        HPX_EXPORT void* create(input_archive& ar) const;
+
+        template <typename T>
+        T* create(input_archive& ar) const
+        {
+            return static_cast<T*>(create(ar));
+        }
+
+        // management of the ids
+        HPX_EXPORT void register_typename(
+            std::string const& name, std::uint32_t id);
+        HPX_EXPORT void fill_missing_typenames();
+        HPX_EXPORT std::uint32_t try_get_id(std::string const& name) const;
+        HPX_EXPORT std::vector<std::string> get_unassigned_typenames() const;
+        HPX_EXPORT void get_assigned_typenames(std::vector<std::string>& names,
+            std::vector<std::uint32_t>& ids) const;
+
+        std::uint32_t get_max_registered_id() const
+        {
+            return max_id_;
+        }
+
     private:
+        void cache_id(std::uint32_t id, ctor_type fun);
+
         ctor_map_type map_;
+
+        std::uint32_t max_id_;
+        typename_to_id_type typename_to_id_;
+        cache_type cache_;
     };
 
     template <typename T, typename Enable = void>
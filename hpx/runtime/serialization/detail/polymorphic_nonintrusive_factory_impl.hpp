@@ -24,6 +24,13 @@ namespace hpx { namespace serialization { namespace detail
        // It's safe to call typeid here. The typeid(t) return value is
        // only used for local lookup to the portable string that goes over the
        // wire
+       //
+       // Unlike intrusively registered classes (see
+       // polymorphic_intrusive_factory::save_name) the name is sent even if
+       // the archive has type ids enabled. Nonintrusive registration is used
+       // for user classes only, which are rarely sent in parcels. The
+       // runtime's own polymorphic types (actions, functions) are all
+       // registered intrusively.
        const std::string class_name = typeinfo_map_.at(typeid(t).name());
        ar << class_name;
 
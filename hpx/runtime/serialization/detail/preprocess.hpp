@@ -163,6 +163,12 @@ namespace hpx { namespace traits
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(serialization::detail::preprocess& cont,
+            std::size_t size)
+        {
+            return cont.resize(size);
+        }
+
         // functions related to output operations
         static void await_future(
             serialization::detail::preprocess& cont
@@ -44,9 +44,12 @@ namespace hpx { namespace serialization
         template <typename Container>
         input_archive(Container & buffer,
                 std::size_t inbound_data_size = 0,
-                const std::vector<serialization_chunk>* chunks = nullptr)
+                const std::vector<serialization_chunk>* chunks = nullptr,
+                const std::vector<std::shared_ptr<void> >* chunk_owners =
+                    nullptr)
           : base_type(0U)
-          , buffer_(new input_container<Container>(buffer, chunks, inbound_data_size))
+          , buffer_(new input_container<Container>(
+                buffer, chunks, inbound_data_size, chunk_owners))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -136,6 +139,8 @@ namespace hpx { namespace serialization
         friend struct basic_archive<input_archive>;
         template <class T>
         friend class array;
+        template <typename T, typename Allocator>
+        friend class serialize_buffer;
 
         template <typename T>
         void load_bitwise(T & t, std::false_type)
@@ -149,9 +154,15 @@ namespace hpx { namespace serialization
         {
             static_assert(!std::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if(disable_array_optimization())
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if(disable_array_optimization() || archive_endianess_differs)
             {
-                access::serialize(*this, t, 0);
+                load_bitwise_fallback(t,
+                    is_serializable_per_member<T>());
             }
             else
             {
@@ -159,6 +170,20 @@ namespace hpx { namespace serialization
             }
         }
 
+        template <typename T>
+        void load_bitwise_fallback(T & t, std::true_type)
+        {
+            access::serialize(*this, t, 0);
+        }
+
+        // types inferred to be bitwise serializable have no other way of
+        // being serialized, their bytes are copied as for float and double
+        template <typename T>
+        void load_bitwise_fallback(T & t, std::false_type)
+        {
+            load_binary(&t, sizeof(t));
+        }
+
         template <class T>
         void load_nonintrusively_polymorphic(T& t, std::false_type)
         {
@@ -259,6 +284,23 @@ namespace hpx { namespace serialization
             size_ += count;
         }
 
+        // Instead of copying the next zero-copy chunk, return its address
+        // and a reference keeping its memory alive. This is possible only if
+        // the chunk has the given size and alignment and if the owners of
+        // the chunks have been passed to the constructor of the archive.
+        bool adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            void*& address, std::shared_ptr<void>& owner)
+        {
+            if (0 == count || disable_data_chunking())
+                return false;
+
+            if (!buffer_->adopt_binary_chunk(count, alignment, address, owner))
+                return false;
+
+            size_ += count;
+            return true;
+        }
+
         // make functions visible through adl
         friend void register_pointer(input_archive& ar,
                 std::uint64_t pos, detail::ptr_helper_ptr helper)
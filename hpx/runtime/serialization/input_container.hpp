@@ -59,16 +59,21 @@ namespace hpx { namespace serialization
 
         input_container(Container const& cont,
                 std::vector<serialization_chunk> const* chunks,
-                std::size_t inbound_data_size)
+                std::size_t inbound_data_size,
+                std::vector<std::shared_ptr<void> > const* chunk_owners =
+                    nullptr)
           : cont_(cont), current_(0), filter_(),
             decompressed_size_(inbound_data_size),
             chunks_(nullptr), current_chunk_(std::size_t(-1)),
-            current_chunk_size_(0)
+            current_chunk_size_(0), chunk_owners_(nullptr)
         {
             if (chunks && chunks->size() != 0)
             {
                 chunks_ = chunks;
                 current_chunk_ = 0;
+
+                if (chunk_owners && chunk_owners->size() == chunks->size())
+                    chunk_owners_ = chunk_owners;
             }
         }
 
@@ -76,8 +81,19 @@ namespace hpx { namespace serialization
         {
             filter_.reset(filter);
             if (filter) {
-                current_ = access_traits::init_data(cont_, filter_.get(),
-                    current_, decompressed_size_);
+                // the archive header was stored uncompressed, the filter
+                // has to produce the remaining data
+                std::size_t const header_size = current_;
+                if (decompressed_size_ < header_size)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error
+                      , "input_container::set_filter"
+                      , "archive data bstream is too short");
+                    return;
+                }
+
+                current_ = header_size + access_traits::init_data(cont_,
+                    filter_.get(), current_, decompressed_size_ - header_size);
 
                 if (decompressed_size_ < current_)
                 {
@@ -136,9 +152,12 @@ namespace hpx { namespace serialization
         {
             HPX_ASSERT((std::int64_t)count >= 0);
 
-            if (chunks_ == nullptr ||
-                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD ||
-                filter_)
+            // the sender decides which chunks are sent as separate
+            // (zero-copy) chunks, those are found in sequence with the
+            // data serialized into the main buffer
+            if (chunks_ == nullptr || filter_ ||
+                current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) != chunk_type_pointer)
             {
                 // fall back to serialization_chunk-less archive
                 this->input_container::load_binary(address, count);
@@ -163,6 +182,32 @@ namespace hpx { namespace serialization
             }
         }
 
+        bool adopt_binary_chunk(std::size_t count, std::size_t alignment,
+            void*& address, std::shared_ptr<void>& owner) // override
+        {
+            if (chunks_ == nullptr || chunk_owners_ == nullptr || filter_ ||
+                current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return false;
+            }
+
+            std::shared_ptr<void> const& chunk_owner =
+                (*chunk_owners_)[current_chunk_];
+            void* pos = get_chunk_data(current_chunk_).pos_;
+            if (!chunk_owner ||
+                reinterpret_cast<std::uintptr_t>(pos) % alignment != 0)
+            {
+                return false;
+            }
+
+            address = pos;
+            owner = chunk_owner;
+            ++current_chunk_;
+            return true;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -171,6 +216,9 @@ namespace hpx { namespace serialization
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // optional owners of the memory referenced by the pointer chunks
+        std::vector<std::shared_ptr<void> > const* chunk_owners_;
     };
 }}
 
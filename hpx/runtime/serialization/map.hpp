@@ -19,18 +19,6 @@
 
 namespace hpx
 {
-    namespace traits
-    {
-        template <typename Key, typename Value>
-        struct is_bitwise_serializable<std::pair<Key, Value> >
-          : std::integral_constant<
-                bool,
-                is_bitwise_serializable<typename std::remove_const<Key>::type>::value
-             && is_bitwise_serializable<typename std::remove_const<Value>::type>::value
-            >
-        {};
-    }
-
     namespace serialization
     {
         namespace detail
@@ -43,7 +43,8 @@ namespace hpx { namespace serialization
         inline std::unique_ptr<erased_output_container>
         create_output_container(Container& buffer,
             std::vector<serialization_chunk>* chunks,
-            binary_filter* filter, std::false_type)
+            binary_filter* filter, std::size_t zero_copy_serialization_threshold,
+            std::false_type)
         {
             std::unique_ptr<erased_output_container> res;
             if (filter == nullptr)
@@ -56,7 +57,7 @@ namespace hpx { namespace serialization
                 else
                 {
                     res.reset(new output_container<Container, vector_chunker>(
-                        buffer, chunks));
+                        buffer, chunks, zero_copy_serialization_threshold));
                 }
             }
             else
@@ -71,7 +72,7 @@ namespace hpx { namespace serialization
                 {
                     res.reset(
                         new filtered_output_container<Container, vector_chunker>(
-                            buffer, chunks));
+                            buffer, chunks, zero_copy_serialization_threshold));
                 }
             }
             return res;
@@ -81,19 +82,20 @@ namespace hpx { namespace serialization
         inline std::unique_ptr<erased_output_container>
         create_output_container(Container& buffer,
             std::vector<serialization_chunk>* chunks,
-            binary_filter* filter, std::true_type)
+            binary_filter* filter, std::size_t zero_copy_serialization_threshold,
+            std::true_type)
         {
             std::unique_ptr<erased_output_container> res;
             if (filter == nullptr)
             {
                 res.reset(new output_container<Container, counting_chunker>(
-                    buffer, chunks));
+                    buffer, chunks, zero_copy_serialization_threshold));
             }
             else
             {
                 res.reset(
                     new filtered_output_container<Container, counting_chunker>(
-                        buffer, chunks));
+                        buffer, chunks, zero_copy_serialization_threshold));
             }
             return res;
         }
@@ -121,9 +123,12 @@ namespace hpx { namespace serialization
         output_archive(Container & buffer,
                 std::uint32_t flags = 0U,
                 std::vector<serialization_chunk>* chunks = nullptr,
-                binary_filter* filter = nullptr)
+                binary_filter* filter = nullptr,
+                std::size_t zero_copy_serialization_threshold =
+                    HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
           : base_type(make_flags(flags, chunks))
           , buffer_(detail::create_output_container(buffer, chunks, filter,
+                zero_copy_serialization_threshold,
                 typename traits::serialization_access_data<Container>::
                     preprocessing_only()))
           , split_gids_(nullptr)
@@ -171,6 +176,13 @@ namespace hpx { namespace serialization
             return size_;
         }
 
+        // number of bytes moved because the container had to grow beyond
+        // its capacity
+        std::size_t bytes_reallocated() const
+        {
+            return buffer_->get_reallocated_bytes();
+        }
+
         void add_gid(naming::gid_type const & gid,
             naming::gid_type const & split_gid);
 
@@ -268,9 +280,15 @@ namespace hpx { namespace serialization
         {
             static_assert(!std::is_abstract<T>::value,
                 "Can not bitwise serialize a class that is abstract");
-            if(disable_array_optimization())
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if(disable_array_optimization() || archive_endianess_differs)
             {
-                access::serialize(*this, t, 0);
+                save_bitwise_fallback(t,
+                    is_serializable_per_member<T>());
             }
             else
             {
@@ -278,6 +296,20 @@ namespace hpx { namespace serialization
             }
         }
 
+        template <typename T>
+        void save_bitwise_fallback(T const & t, std::true_type)
+        {
+            access::serialize(*this, t, 0);
+        }
+
+        // types inferred to be bitwise serializable have no other way of
+        // being serialized, their bytes are copied as for float and double
+        template <typename T>
+        void save_bitwise_fallback(T const & t, std::false_type)
+        {
+            save_binary(&t, sizeof(t));
+        }
+
         template <typename T>
         void save_nonintrusively_polymorphic(T const & t, std::false_type)
         {
@@ -14,12 +14,14 @@
 #include <hpx/runtime/serialization/binary_filter.hpp>
 #include <hpx/runtime/serialization/container.hpp>
 #include <hpx/runtime/serialization/serialization_chunk.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/traits/serialization_access_data.hpp>
 #include <hpx/util/assert.hpp>
 
 #include <cstddef> // for size_t
 #include <cstdint>
 #include <cstring> // for memcpy
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -162,8 +164,13 @@ namespace hpx { namespace serialization
         typedef traits::serialization_access_data<Container> access_traits;
 
         output_container(Container& cont,
-                std::vector<serialization_chunk>* chunks = nullptr)
-          : cont_(cont), current_(0), chunker_(chunks)
+                std::vector<serialization_chunk>* chunks = nullptr,
+                std::size_t zero_copy_serialization_threshold =
+                    HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+          : cont_(cont), current_(0), chunker_(chunks),
+            zero_copy_serialization_threshold_(
+                zero_copy_serialization_threshold),
+            reallocated_bytes_(0)
         {
             chunker_.reset();
         }
@@ -215,6 +222,11 @@ namespace hpx { namespace serialization
             return chunker_.get_num_chunks();
         }
 
+        std::size_t get_reallocated_bytes() const // override
+        {
+            return reallocated_bytes_;
+        }
+
         void reset()
         {
             chunker_.reset();
@@ -244,7 +256,7 @@ namespace hpx { namespace serialization
 
             std::size_t new_current = current_ + count;
             if (access_traits::size(cont_) < new_current)
-                access_traits::resize(cont_, count);
+                grow(count);
 
             access_traits::write(cont_, count, current_, address);
 
@@ -253,7 +265,7 @@ namespace hpx { namespace serialization
 
         std::size_t save_binary_chunk(void const* address, std::size_t count) // override
         {
-            if (count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            if (count < this->zero_copy_serialization_threshold_)
             {
                 // fall back to serialization_chunk-less archive
                 this->output_container::save_binary(address, count);
@@ -283,9 +295,24 @@ namespace hpx { namespace serialization
         }
 
     protected:
+        // grow the container by the given number of bytes
+        void grow(std::size_t count)
+        {
+            std::size_t size = access_traits::size(cont_);
+            if (access_traits::capacity(cont_) < size + count)
+                reallocated_bytes_ += size;
+
+            access_traits::resize(cont_, count);
+        }
+
         Container& cont_;
         std::size_t current_;
         Chunker chunker_;
+
+        // chunks smaller than this are copied into the container
+        std::size_t zero_copy_serialization_threshold_;
+
+        std::size_t reallocated_bytes_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -296,8 +323,11 @@ namespace hpx { namespace serialization
         typedef output_container<Container, Chunker> base_type;
 
         filtered_output_container(Container& cont,
-                std::vector<serialization_chunk>* chunks = nullptr)
-          : output_container<Container, Chunker>(cont, chunks),
+                std::vector<serialization_chunk>* chunks = nullptr,
+                std::size_t zero_copy_serialization_threshold =
+                    HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+          : output_container<Container, Chunker>(
+                cont, chunks, zero_copy_serialization_threshold),
             start_compressing_at_(0), filter_(nullptr)
         {}
 
@@ -308,28 +338,54 @@ namespace hpx { namespace serialization
         {
             std::size_t written = 0;
 
-            if (access_traits::size(this->cont_) < this->current_)
-                access_traits::resize(this->cont_, this->current_);
+            // make room for the filtered data in one go, if possible
+            std::size_t needed = this->current_;
+            std::size_t max_length = 0;
+            if (filter_ != nullptr)
+            {
+                max_length = filter_->get_max_flush_length(
+                    this->current_ - start_compressing_at_);
+                if (max_length != 0)
+                    needed = start_compressing_at_ + max_length;
+            }
+
+            std::size_t size = access_traits::size(this->cont_);
+            if (size < needed)
+                this->grow(needed - size);
 
             this->current_ = start_compressing_at_;
 
             do {
+                size = access_traits::size(this->cont_);
+
                 bool flushed = access_traits::flush(
                     filter_, this->cont_, this->current_,
-                    access_traits::size(this->cont_)-this->current_, written);
+                    size - this->current_, written);
 
                 this->current_ += written;
                 if (flushed)
                     break;
 
-                // resize container
-                std::size_t size = access_traits::size(this->cont_);
-                access_traits::resize(this->cont_, 2 * size);
+                // growing the container does not help if it has room for the
+                // maximal length of the filtered data already, or if it can't
+                // be doubled
+                if ((max_length != 0 &&
+                        size - start_compressing_at_ >= max_length) ||
+                    size == 0 ||
+                    size > (std::numeric_limits<std::size_t>::max)() / 2)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "filtered_output_container::flush",
+                        "the binary filter was not able to flush its data");
+                }
+
+                // double the size of the container
+                this->grow(size);
 
             } while (true);
 
             // truncate container
-            access_traits::resize(this->cont_, this->current_);
+            access_traits::truncate(this->cont_, this->current_);
         }
 
         void set_filter(binary_filter* filter) // override
@@ -345,15 +401,21 @@ namespace hpx { namespace serialization
         {
             HPX_ASSERT(count != 0);
 
-            // during construction the filter may not have been set yet
-            if (filter_ != nullptr)
-                filter_->save(address, count);
+            // the archive header is written before the filter is set, it is
+            // stored uncompressed
+            if (filter_ == nullptr)
+            {
+                this->base_type::save_binary(address, count);
+                return;
+            }
+
+            filter_->save(address, count);
             this->current_ += count;
         }
 
         std::size_t save_binary_chunk(void const* address, std::size_t count) // override
         {
-            if (count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
+            if (count < this->zero_copy_serialization_threshold_)
             {
                 // fall back to serialization_chunk-less archive
                 HPX_ASSERT(count != 0);
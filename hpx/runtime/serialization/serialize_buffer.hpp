@@ -11,13 +11,16 @@
 #include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/throw_exception.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/traits/supports_streaming_with_any.hpp>
 #include <hpx/util/bind_back.hpp>
 
+#include <boost/predef/other/endian.h>
 #include <boost/shared_array.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace hpx { namespace serialization
@@ -247,11 +250,55 @@ namespace hpx { namespace serialization
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // A buffer received as a separate (zero-copy) chunk can refer to the
+        // memory it was received into instead of copying it, as long as no
+        // custom allocator is involved and the data needs no conversion.
+        template <typename Archive>
+        bool load_adopted(Archive& ar, std::true_type)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = ar.endian_little();
+#else
+            bool archive_endianess_differs = ar.endian_big();
+#endif
+            if (ar.disable_array_optimization() || archive_endianess_differs)
+                return false;
+
+            void* address = nullptr;
+            std::shared_ptr<void> owner;
+            if (!ar.adopt_binary_chunk(size_ * sizeof(T), alignof(T),
+                    address, owner))
+            {
+                return false;
+            }
+
+            data_.reset(static_cast<T*>(address),
+                util::bind_back(&serialize_buffer::owner_deleter,
+                    std::move(owner)));
+            return true;
+        }
+
+        template <typename Archive>
+        bool load_adopted(Archive& ar, std::false_type)
+        {
+            return false;
+        }
+
+        static void owner_deleter(T*, std::shared_ptr<void> const&) {}
+
         template <typename Archive>
         void load(Archive& ar, const unsigned int version)
         {
             ar >> size_ >> alloc_; //-V128
 
+            typedef std::integral_constant<bool,
+                    std::is_same<Allocator, std::allocator<T> >::value &&
+                    hpx::traits::is_bitwise_serializable<T>::value
+                > may_adopt;
+
+            if (size_ != 0 && load_adopted(ar, may_adopt()))
+                return;
+
             data_.reset(alloc_.allocate(size_),
                 util::bind_back(&serialize_buffer::deleter<allocator_type>,
                     alloc_, size_));
@@ -7,6 +7,7 @@
 #define __HPXVALARRAY_H__
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/array.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/include/components.hpp>
@@ -27,8 +28,8 @@ namespace hpx { namespace serialization
 
         if(sz < 1) return;
 
-        for(std::size_t i = 0; i < sz; ++i)
-           ar >> arr[i];
+        // bitwise serializable elements are loaded in one go
+        ar >> hpx::serialization::make_array(&arr[0], sz);
     }
 
     template<typename T>
@@ -38,8 +39,10 @@ namespace hpx { namespace serialization
 
         const std::size_t sz = arr.size();
         ar & sz;
-        for(auto v : arr)
-          ar << v;
+        if(sz < 1) return;
+
+        // bitwise serializable elements are saved in one go
+        ar << hpx::serialization::make_array(&arr[0], sz);
     }
 
 }}
@@ -115,10 +115,21 @@ namespace hpx { namespace threads { namespace coroutines
             impl_.rebind(std::move(f), id);
         }
 
+        // return the stack to the stack pool (if enabled), a new stack is
+        // attached on the next invocation
+        void release_stack()
+        {
+            HPX_ASSERT(!impl_.running());
+            impl_.release_stack();
+        }
+
         HPX_FORCEINLINE result_type operator()(arg_type arg = arg_type())
         {
             HPX_ASSERT(impl_.is_ready());
 
+            if (impl_.is_stackless())
+                return impl_.invoke_directly(arg);
+
             impl_.bind_args(&arg);
 
             impl_.invoke();
@@ -131,6 +142,11 @@ namespace hpx { namespace threads { namespace coroutines
             return impl_.is_ready();
         }
 
+        bool is_stackless() const
+        {
+            return impl_.is_stackless();
+        }
+
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
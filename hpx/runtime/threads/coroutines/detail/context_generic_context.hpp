@@ -247,6 +247,9 @@ namespace hpx { namespace threads { namespace coroutines
                 }
             }
 
+            // stacks are not pooled for this context implementation
+            void release_stack() {}
+
             void rebind_stack()
             {
                 if (ctx_)
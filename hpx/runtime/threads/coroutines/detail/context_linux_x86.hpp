@@ -17,6 +17,7 @@
 #include <hpx/config.hpp>
 #include <hpx/runtime/threads/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/coroutines/detail/swap_context.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/format.hpp>
@@ -211,7 +212,8 @@ namespace hpx { namespace threads { namespace coroutines
                             m_stack_size));
                 }
 
-                m_stack = posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+                m_stack = posix::pool_alloc_stack(
+                    static_cast<std::size_t>(m_stack_size));
                 if (m_stack == nullptr)
                 {
                     throw std::runtime_error("could not allocate memory for stack");
@@ -326,7 +328,11 @@ namespace hpx { namespace threads { namespace coroutines
 
             void rebind_stack()
             {
-                HPX_ASSERT(m_stack);
+                // the stack has been returned to the stack pool, init() will
+                // attach a new one
+                if (m_stack == nullptr)
+                    return;
+
                 increment_stack_recycle_count();
 
                 // On rebind, we initialize our stack to ensure a virgin stack
@@ -344,6 +350,22 @@ namespace hpx { namespace threads { namespace coroutines
 #endif
             }
 
+            // Return the stack to the stack pool, this must be called only
+            // while the context is not running.
+            void release_stack()
+            {
+                if (m_stack == nullptr || !posix::use_stack_pool())
+                    return;
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+                VALGRIND_STACK_DEREGISTER(
+                    reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+                posix::pool_free_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+                m_stack = nullptr;
+            }
+
             std::ptrdiff_t get_available_stack_space()
             {
                 return get_stack_ptr() - reinterpret_cast<std::size_t>(m_stack) -
@@ -343,6 +343,9 @@ namespace hpx { namespace threads { namespace coroutines
                 }
             }
 
+            // stacks are not pooled for this context implementation
+            void release_stack() {}
+
             void rebind_stack()
             {
                 if (m_stack)
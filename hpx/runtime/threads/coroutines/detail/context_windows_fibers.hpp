@@ -235,6 +235,9 @@ namespace hpx { namespace threads { namespace coroutines
             {
             }
 
+            // stacks are not pooled for this context implementation
+            void release_stack() noexcept {}
+
             void rebind_stack() noexcept
             {
                 increment_stack_recycle_count();
@@ -45,6 +45,7 @@
 #include <hpx/util/unique_function.hpp>
 
 #include <cstddef>
+#include <limits>
 #include <utility>
 
 namespace hpx { namespace threads { namespace coroutines { namespace detail
@@ -81,7 +82,19 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         HPX_EXPORT void operator()() noexcept;
 
+        // Execute the stored function directly on the stack of the calling
+        // thread. This is used for stackless coroutines only.
+        HPX_EXPORT result_type invoke_directly(arg_type arg);
+
     public:
+        // A stackless coroutine never allocates a stack of its own, it is
+        // executed by invoke_directly() and is not allowed to yield.
+        bool is_stackless() const
+        {
+            return this->get_stacksize() ==
+                (std::numeric_limits<std::ptrdiff_t>::max)();
+        }
+
         void bind_result(result_type res)
         {
             m_result = res;
@@ -111,14 +124,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
 
         void reset()
         {
-            this->reset_stack();
+            if (!is_stackless())
+                this->reset_stack();
             m_fun.reset(); // just reset the bound function
             this->super_type::reset();
         }
 
         void rebind(functor_type && f, thread_id_type id)
         {
-            this->rebind_stack();     // count how often a coroutines object was reused
+            if (!is_stackless())
+                this->rebind_stack(); // count how often a coroutines object was reused
             m_fun = std::move(f);
             this->super_type::rebind_base(id);
         }
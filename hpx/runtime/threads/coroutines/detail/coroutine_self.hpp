@@ -34,6 +34,7 @@
 #include <hpx/runtime/threads/coroutines/detail/coroutine_impl.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/runtime/threads/thread_id_type.hpp>
+#include <hpx/throw_exception.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/function.hpp>
 #if defined(HPX_HAVE_APEX)
@@ -93,6 +94,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         arg_type yield_impl(result_type arg)
         {
             HPX_ASSERT(m_pimpl);
+            if (m_pimpl->is_stackless())
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "coroutine_self::yield_impl",
+                    "stackless threads are not allowed to suspend");
+            }
 
             this->m_pimpl->bind_result(arg);
 
@@ -132,6 +139,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
             return tmp;
         }
 
+        bool is_stackless() const
+        {
+            HPX_ASSERT(m_pimpl);
+            return m_pimpl->is_stackless();
+        }
+
         thread_id_type get_thread_id() const
         {
             HPX_ASSERT(m_pimpl);
@@ -151,6 +164,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         std::ptrdiff_t get_available_stack_space()
         {
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+            // stackless threads run on the stack of the scheduling thread
+            if (m_pimpl->is_stackless())
+                return (std::numeric_limits<std::ptrdiff_t>::max)();
             return m_pimpl->get_available_stack_space();
 #else
             return (std::numeric_limits<std::ptrdiff_t>::max)();
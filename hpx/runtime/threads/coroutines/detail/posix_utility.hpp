@@ -74,6 +74,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 namespace posix
 {
     HPX_EXPORT extern bool use_guard_pages;
+    HPX_EXPORT extern bool use_huge_pages;
 
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
  && _POSIX_MAPPED_FILES > 0
@@ -109,6 +110,15 @@ namespace posix
             }
         }
 
+#if defined(MADV_HUGEPAGE)
+        if (use_huge_pages)
+        {
+            // Ask for the stack to be backed by transparent huge pages, this
+            // is effective for stacks spanning at least one huge page only.
+            ::madvise(real_stack, size + EXEC_PAGESIZE, MADV_HUGEPAGE);
+        }
+#endif
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
         {
@@ -0,0 +1,67 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+#define HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP
+
+#include <hpx/config.hpp>
+
+// The stack pool is used by the context implementation for Linux on x86 only
+// (see context_impl.hpp)
+#if !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES) &&                           \
+    (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    !defined(__bgq__) && !defined(__powerpc__) && !defined(__s390x_)
+#define HPX_HAVE_COROUTINE_STACK_POOL
+#endif
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+    namespace posix
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The stack pool keeps the stacks of terminated HPX threads for reuse.
+        // There is one pool per NUMA domain, stacks are returned to (and taken
+        // from) the pool of the NUMA domain the calling worker thread runs on.
+        //
+        // For each stack size the pool keeps up to 'stack_pool_low_watermark'
+        // stacks hot (i.e. with their physical memory attached). Stacks
+        // returned beyond that are made cold by releasing their physical
+        // memory (madvise), and stacks returned while more than
+        // 'stack_pool_high_watermark' stacks are pooled are unmapped.
+        //
+        // These global variables are initialized from the runtime
+        // configuration ([hpx.stacks]), a high watermark of zero disables the
+        // stack pool (stacks stay attached to the recycled thread objects).
+        HPX_EXPORT extern std::size_t stack_pool_high_watermark;
+        HPX_EXPORT extern std::size_t stack_pool_low_watermark;
+        HPX_EXPORT extern bool use_madv_free;
+
+        inline bool use_stack_pool()
+        {
+            return stack_pool_high_watermark != 0;
+        }
+
+        // Allocate a stack of the given size, reusing a pooled stack if
+        // possible.
+        HPX_EXPORT void* pool_alloc_stack(std::size_t size);
+
+        // Return a stack to the pool (or free it if the pool is full).
+        HPX_EXPORT void pool_free_stack(void* stack, std::size_t size);
+
+        // performance counter support
+        HPX_EXPORT std::uint64_t get_stack_allocation_count(bool reset);
+        HPX_EXPORT std::uint64_t get_stack_reuse_count(bool reset);
+        HPX_EXPORT std::uint64_t get_stack_trim_count(bool reset);
+    }
+}}}}
+
+#endif
+#endif /*HPX_RUNTIME_THREADS_COROUTINES_DETAIL_STACK_POOL_HPP*/
@@ -240,6 +240,62 @@ namespace hpx { namespace threads { namespace detail
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_steal_batches(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_steal_batches(num, reset);
+        }
+
+        std::int64_t get_average_steal_batch_size(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_average_steal_batch_size(num, reset);
+        }
+
+        std::int64_t get_max_steal_batch_size(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_max_steal_batch_size(num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_core(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_core(num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_numa_domain(
+                num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_from_remote_numa_domain(
+                num, reset);
+        }
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_num_parks(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_parks(num, reset);
+        }
+
+        std::int64_t get_num_unparks(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_unparks(num, reset);
+        }
+
+        std::int64_t get_average_wake_latency(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_average_wake_latency(num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool reset) override
@@ -189,7 +189,7 @@ namespace hpx { namespace threads { namespace detail
             sched_->Scheduler::set_all_states_at_least(state_stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::do_some_work_all();
 
             if (blocking)
             {
@@ -202,7 +202,7 @@ namespace hpx { namespace threads { namespace detail
                     // make sure no OS thread is waiting
                     LTM_(info) << "stop: " << id_.name() << " notify_all";
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::do_some_work_all();
 
                     LTM_(info) << "stop: " << id_.name() << " join:" << i;
 
@@ -11,6 +11,7 @@
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/get_thread_name.hpp>
 #include <hpx/runtime/runtime_fwd.hpp>
+#include <hpx/runtime/threads/detail/thread_description_profiler.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
@@ -330,6 +331,39 @@ namespace hpx { namespace threads { namespace detail
         bool& is_active_;
     };
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    ///////////////////////////////////////////////////////////////////////////
+    // collect per-thread-description statistics for one thread phase
+    struct profile_phase_wrapper
+    {
+        profile_phase_wrapper(bool enabled, thread_data* thrd,
+                switch_status const& thrd_stat)
+          : thrd_(enabled ? thrd : nullptr)
+          , thrd_stat_(thrd_stat)
+        {
+            if (thrd_ != nullptr)
+                thread_description_profiler::instance().begin_phase(data_);
+        }
+        ~profile_phase_wrapper()
+        {
+            if (thrd_ != nullptr)
+            {
+                thread_description_profiler::instance().end_phase(thrd_,
+                    data_, thrd_stat_.get_previous() != terminated);
+            }
+        }
+
+        thread_data* thrd_;
+        switch_status const& thrd_stat_;
+        thread_description_profiler::phase_data data_;
+    };
+#else
+    struct profile_phase_wrapper
+    {
+        profile_phase_wrapper(bool, thread_data*, switch_status const&) {}
+    };
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) && defined(HPX_HAVE_THREAD_IDLE_RATES)
     struct scheduling_counters
@@ -582,6 +616,13 @@ namespace hpx { namespace threads { namespace detail
         idle_collect_rate idle_rate(counters.tfunc_time_, counters.exec_time_);
         tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        bool const profile_descriptions =
+            thread_description_profiler::instance().enabled();
+#else
+        bool const profile_descriptions = false;
+#endif
+
         // spin for some time after queues have become empty
         bool may_exit = false;
 
@@ -639,6 +680,7 @@ namespace hpx { namespace threads { namespace detail
                 HPX_ASSERT(thrd->get_scheduler_base() == &scheduler);
 
                 idle_loop_count = params.max_idle_loop_count_;
+                scheduler.SchedulingPolicy::end_idle_period(num_thread);
                 ++busy_loop_count;
 
                 may_exit = false;
@@ -681,6 +723,10 @@ namespace hpx { namespace threads { namespace detail
                                 // and add to aggregate execution time.
                                 exec_time_wrapper exec_time_collector(idle_rate);
 
+                                // Collect the statistics for the description
+                                // of this thread, if enabled.
+                                profile_phase_wrapper profile_phase(
+                                    profile_descriptions, thrd, thrd_stat);
 
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are resuming the
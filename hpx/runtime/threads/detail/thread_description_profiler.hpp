@@ -0,0 +1,137 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_THREADS_DETAIL_THREAD_DESCRIPTION_PROFILER_FEB_02_2019_1112AM)
+#define HPX_RUNTIME_THREADS_DETAIL_THREAD_DESCRIPTION_PROFILER_FEB_02_2019_1112AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+#include <hpx/error_code.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/runtime/threads/thread_data_fwd.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/static.hpp>
+#include <hpx/util/thread_description.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Collects execution statistics for HPX threads, aggregated by their
+    // thread description (i.e. the annotated function name). The profiler is
+    // disabled by default, it is enabled by setting
+    // hpx.thread_profiling.enabled=1. Hardware counters (cycles and cache
+    // misses) are collected on Linux only, they have to be enabled separately
+    // by setting hpx.thread_profiling.hardware_counters=1.
+    class HPX_EXPORT thread_description_profiler
+    {
+    public:
+        HPX_NON_COPYABLE(thread_description_profiler);
+
+    public:
+        // accumulated statistics for one thread description
+        struct statistics
+        {
+            statistics()
+              : phases_(0), exec_time_(0), suspensions_(0),
+                cycles_(0), cache_misses_(0)
+            {}
+
+            std::uint64_t phases_;
+            std::uint64_t exec_time_;       // [ns]
+            std::uint64_t suspensions_;
+            std::uint64_t cycles_;
+            std::uint64_t cache_misses_;
+        };
+
+        // values sampled at the beginning of a thread phase
+        struct phase_data
+        {
+            std::uint64_t start_time_;
+            std::uint64_t cycles_;
+            std::uint64_t cache_misses_;
+        };
+
+        typedef hpx::util::function_nonser<
+                std::int64_t(std::string const&, bool)
+            > counter_function_type;
+
+        thread_description_profiler();
+        ~thread_description_profiler();
+
+        static thread_description_profiler& instance();
+
+        // read the configuration, needs to be called before the worker
+        // threads are started
+        void init();
+
+        bool enabled() const
+        {
+            return enabled_;
+        }
+
+        // called by the scheduling loop before and after each thread phase
+        void begin_phase(phase_data& data);
+        void end_phase(thread_data* thrd, phase_data const& data,
+            bool suspended);
+
+        // retrieve the (accumulated) statistics for all thread descriptions
+        // matching the given name, all descriptions if the name is empty
+        statistics get_statistics(std::string const& name, bool reset);
+
+        std::int64_t get_phases(std::string const& name, bool reset);
+        std::int64_t get_exec_time(std::string const& name, bool reset);
+        std::int64_t get_suspensions(std::string const& name, bool reset);
+        std::int64_t get_cycles(std::string const& name, bool reset);
+        std::int64_t get_cache_misses(std::string const& name, bool reset);
+
+        // print the collected statistics, most expensive descriptions first
+        void print(std::ostream& os);
+
+        // print the collected statistics to std::cerr if the profiler is
+        // enabled and hpx.thread_profiling.print_at_shutdown is set
+        void print_at_shutdown();
+
+        bool counter_discoverer(
+            performance_counters::counter_info const& info,
+            performance_counters::counter_path_elements& p,
+            performance_counters::discover_counter_func const& f,
+            performance_counters::discover_counters_mode mode, error_code& ec);
+
+    private:
+        struct worker_data;
+
+        worker_data& get_worker_data();
+
+        // accumulated statistics of all workers, aggregated by name
+        std::map<std::string, statistics> collect(bool reset);
+
+        typedef hpx::util::spinlock mutex_type;
+
+        bool enabled_;
+        bool hardware_counters_;
+        bool print_at_shutdown_;
+
+        mutex_type mtx_;
+        std::vector<std::unique_ptr<worker_data>> workers_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
@@ -0,0 +1,159 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_THREADS_POLICIES_EDF_QUEUE_BACKEND_JAN_27_2019_0452PM)
+#define HPX_THREADS_POLICIES_EDF_QUEUE_BACKEND_JAN_27_2019_0452PM
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/runtime/threads/thread_init_data.hpp>
+#include <hpx/util/spinlock.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace policies
+{
+    struct edf_queue;
+
+    namespace detail
+    {
+        // extract the deadline from the items stored in the thread queues
+        inline std::uint64_t get_deadline(threads::thread_data const* thrd)
+        {
+            return thrd->get_deadline();
+        }
+
+        template <typename... Ts>
+        std::uint64_t get_deadline(
+            util::tuple<threads::thread_data*, Ts...> const* thrd)
+        {
+            return util::get<0>(*thrd)->get_deadline();
+        }
+
+        template <typename... Ts>
+        std::uint64_t get_deadline(
+            util::tuple<threads::thread_init_data, Ts...> const* task)
+        {
+            return util::get<0>(*task).deadline;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first: the queue is ordered by the absolute deadline
+    // of its items, both the owning OS thread and thieves always take the most
+    // urgent item. Items without a deadline are queued behind all items with a
+    // deadline in FIFO order. Items pushed to the other end (i.e. yielding
+    // threads) are queued behind all items currently in the queue which have
+    // a deadline.
+    template <typename T>
+    struct edf_queue_backend
+    {
+        typedef T value_type;
+        typedef T& reference;
+        typedef T const& const_reference;
+        typedef std::uint64_t size_type;
+
+        typedef hpx::util::spinlock mutex_type;
+
+        edf_queue_backend(
+            size_type initial_size = 0
+          , size_type num_thread = size_type(-1)
+            )
+          : sequence_(0)
+          , max_deadline_(0)
+          , size_(0)
+        {
+            heap_.reserve(std::size_t(initial_size));
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            std::uint64_t deadline = detail::get_deadline(val);
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (other_end)
+            {
+                deadline = (std::max)(deadline, max_deadline_);
+            }
+            else if (deadline != no_deadline)
+            {
+                max_deadline_ = (std::max)(deadline, max_deadline_);
+            }
+
+            heap_.push_back(entry{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), entry_compare());
+
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (empty())
+                return false;
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (heap_.empty())
+                return false;
+
+            std::pop_heap(heap_.begin(), heap_.end(), entry_compare());
+            val = heap_.back().value_;
+            heap_.pop_back();
+
+            size_.store(heap_.size(), std::memory_order_relaxed);
+            return true;
+        }
+
+        bool empty()
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+    private:
+        struct entry
+        {
+            std::uint64_t deadline_;
+            std::uint64_t sequence_;
+            T value_;
+        };
+
+        // std::push_heap/pop_heap build a max-heap, the most urgent entry has
+        // to compare greatest
+        struct entry_compare
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const
+            {
+                if (lhs.deadline_ != rhs.deadline_)
+                    return lhs.deadline_ > rhs.deadline_;
+                return lhs.sequence_ > rhs.sequence_;
+            }
+        };
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t sequence_;
+        std::uint64_t max_deadline_;
+        std::atomic<std::size_t> size_;
+    };
+
+    struct edf_queue
+    {
+        template <typename T>
+        struct apply
+        {
+            typedef edf_queue_backend<T> type;
+        };
+    };
+}}}
+
+#endif
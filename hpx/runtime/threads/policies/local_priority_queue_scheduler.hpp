@@ -21,6 +21,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +32,8 @@
 #include <type_traits>
 #include <vector>
 
+#include <boost/lexical_cast.hpp>
+
 #include <hpx/config/warnings_prefix.hpp>
 
 // TODO: add branch prediction and function heat
@@ -46,6 +49,17 @@ namespace hpx { namespace threads { namespace policies
     extern bool minimal_deadlock_detection;
 #endif
 
+    namespace detail
+    {
+        inline std::size_t get_remote_steal_backoff()
+        {
+            static std::size_t remote_steal_backoff =
+                boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                    "hpx.thread_queue.remote_steal_backoff", "16"));
+            return remote_steal_backoff;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     /// The local_priority_queue_scheduler maintains exactly one queue of work
     /// items (threads) per OS thread, where this OS thread pulls its next work
@@ -54,6 +68,13 @@ namespace hpx { namespace threads { namespace policies
     /// High priority threads are executed by the first N OS threads before any
     /// other work is executed. Low priority threads are executed by the last
     /// OS thread whenever no other work is available.
+    ///
+    /// Work is stolen hierarchically: first from OS threads running on the
+    /// same core, then from OS threads in the same NUMA domain, and finally
+    /// (depending on the NUMA sensitivity) from remote NUMA domains. If the
+    /// NUMA sensitivity is set to 3, every OS thread may steal from remote
+    /// NUMA domains, but only after it has failed to find work locally for
+    /// hpx.thread_queue.remote_steal_backoff consecutive attempts.
     template <typename Mutex = compat::mutex,
         typename PendingQueuing = lockfree_fifo,
         typename StagedQueuing = lockfree_fifo,
@@ -72,6 +93,15 @@ namespace hpx { namespace threads { namespace policies
     public:
         typedef std::false_type has_periodic_maintenance;
 
+        // the levels of the stealing hierarchy
+        enum steal_level
+        {
+            steal_level_core = 0,       // OS threads sharing the same core
+            steal_level_numa = 1,       // OS threads in the same NUMA domain
+            steal_level_remote = 2,     // OS threads in other NUMA domains
+            num_steal_levels = 3
+        };
+
         typedef thread_queue<
             Mutex, PendingQueuing, StagedQueuing, TerminatedQueuing
         > thread_queue_type;
@@ -132,7 +162,9 @@ namespace hpx { namespace threads { namespace policies
             low_priority_queue_(init.max_queue_thread_count_),
             queues_(num_queues_),
             high_priority_queues_(num_queues_),
-            victim_threads_(num_queues_)
+            victim_threads_(num_queues_),
+            steal_data_(num_queues_),
+            remote_steal_backoff_(detail::get_remote_steal_backoff())
         {
             if (!deferred_initialization)
             {
@@ -445,6 +477,145 @@ namespace hpx { namespace threads { namespace policies
             }
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_steal_batches(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_steal_batches = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    num_steal_batches += high_priority_queues_[i].data_->
+                        get_num_steal_batches(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    num_steal_batches += queues_[i].data_->
+                        get_num_steal_batches(reset);
+                }
+                return num_steal_batches;
+            }
+
+            num_steal_batches += queues_[num_thread].data_->
+                get_num_steal_batches(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                num_steal_batches += high_priority_queues_[num_thread].data_->
+                    get_num_steal_batches(reset);
+            }
+            return num_steal_batches;
+        }
+
+        std::int64_t get_average_steal_batch_size(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t items = 0;
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    items += high_priority_queues_[i].data_->
+                        get_steal_batch_items(reset);
+                    count += high_priority_queues_[i].data_->
+                        get_steal_batch_count(reset);
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    items += queues_[i].data_->get_steal_batch_items(reset);
+                    count += queues_[i].data_->get_steal_batch_count(reset);
+                }
+            }
+            else
+            {
+                items += queues_[num_thread].data_->
+                    get_steal_batch_items(reset);
+                count += queues_[num_thread].data_->
+                    get_steal_batch_count(reset);
+
+                if (num_thread < num_high_priority_queues_)
+                {
+                    items += high_priority_queues_[num_thread].data_->
+                        get_steal_batch_items(reset);
+                    count += high_priority_queues_[num_thread].data_->
+                        get_steal_batch_count(reset);
+                }
+            }
+            return count == 0 ? 0 : items / count;
+        }
+
+        std::int64_t get_max_steal_batch_size(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t largest = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != num_high_priority_queues_; ++i)
+                {
+                    largest = (std::max)(largest,
+                        high_priority_queues_[i].data_->
+                            get_largest_steal_batch(reset));
+                }
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    largest = (std::max)(largest,
+                        queues_[i].data_->get_largest_steal_batch(reset));
+                }
+                return largest;
+            }
+
+            largest = queues_[num_thread].data_->
+                get_largest_steal_batch(reset);
+
+            if (num_thread < num_high_priority_queues_)
+            {
+                largest = (std::max)(largest,
+                    high_priority_queues_[num_thread].data_->
+                        get_largest_steal_batch(reset));
+            }
+            return largest;
+        }
+
+        std::int64_t get_num_stolen_at_level(steal_level level,
+            std::size_t num_thread, bool reset)
+        {
+            if (num_thread == std::size_t(-1))
+            {
+                std::int64_t num_stolen_threads = 0;
+                for (std::size_t i = 0; i != num_queues_; ++i)
+                {
+                    num_stolen_threads += util::get_and_reset_value(
+                        steal_data_[i].data_.stolen_[level], reset);
+                }
+                return num_stolen_threads;
+            }
+
+            return util::get_and_reset_value(
+                steal_data_[num_thread].data_.stolen_[level], reset);
+        }
+
+        std::int64_t get_num_stolen_from_core(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_at_level(
+                steal_level_core, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_at_level(
+                steal_level_numa, num_thread, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t num_thread, bool reset) override
+        {
+            return get_num_stolen_at_level(
+                steal_level_remote, num_thread, reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -572,6 +743,8 @@ namespace hpx { namespace threads { namespace policies
             thread_queue_type* this_high_priority_queue = nullptr;
             thread_queue_type* this_queue = queues_[num_thread].data_;
 
+            steal_data& sd = steal_data_[num_thread].data_;
+
             if (num_thread < num_high_priority_queues_)
             {
                 this_high_priority_queue =
@@ -581,7 +754,10 @@ namespace hpx { namespace threads { namespace policies
 
                 this_high_priority_queue->increment_num_pending_accesses();
                 if (result)
+                {
+                    sd.failed_attempts_ = 0;
                     return true;
+                }
                 this_high_priority_queue->increment_num_pending_misses();
             }
 
@@ -590,7 +766,10 @@ namespace hpx { namespace threads { namespace policies
 
                 this_queue->increment_num_pending_accesses();
                 if (result)
+                {
+                    sd.failed_attempts_ = 0;
                     return true;
+                }
                 this_queue->increment_num_pending_misses();
 
                 bool have_staged = this_queue->
@@ -608,30 +787,46 @@ namespace hpx { namespace threads { namespace policies
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
+                std::vector<std::size_t> const& victims =
+                    victim_threads_[num_thread].data_;
+                std::size_t num_victims = get_num_victims(num_thread);
+
+                for (std::size_t i = 0; i != num_victims; ++i)
                 {
+                    std::size_t idx = victims[i];
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
                         num_thread < num_high_priority_queues_)
                     {
                         thread_queue_type* q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, running))
+                        std::size_t stolen =
+                            this_high_priority_queue->steal_next_thread(
+                                thrd, q, running);
+                        if (stolen != 0)
                         {
-                            q->increment_num_stolen_from_pending();
+                            q->increment_num_stolen_from_pending(stolen);
                             this_high_priority_queue->
-                                increment_num_stolen_to_pending();
+                                increment_num_stolen_to_pending(stolen);
+                            increment_num_stolen_at_level(
+                                num_thread, i, stolen);
                             return true;
                         }
                     }
 
-                    if (queues_[idx].data_->get_next_thread(thrd, running))
+                    std::size_t stolen = this_queue->steal_next_thread(
+                        thrd, queues_[idx].data_, running);
+                    if (stolen != 0)
                     {
-                        queues_[idx].data_->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
+                        queues_[idx].data_->increment_num_stolen_from_pending(
+                            stolen);
+                        this_queue->increment_num_stolen_to_pending(stolen);
+                        increment_num_stolen_at_level(num_thread, i, stolen);
                         return true;
                     }
                 }
+
+                ++sd.failed_attempts_;
             }
 
             return low_priority_queue_.get_next_thread(thrd);
@@ -1048,8 +1243,13 @@ namespace hpx { namespace threads { namespace policies
 
             if (enable_stealing)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
+                std::vector<std::size_t> const& victims =
+                    victim_threads_[num_thread].data_;
+                std::size_t num_victims = get_num_victims(num_thread);
+
+                for (std::size_t i = 0; i != num_victims; ++i)
                 {
+                    std::size_t idx = victims[i];
                     HPX_ASSERT(idx != num_thread);
 
                     if (idx < num_high_priority_queues_ &&
@@ -1065,6 +1265,7 @@ namespace hpx { namespace threads { namespace policies
                             q->increment_num_stolen_from_staged(added);
                             this_high_priority_queue->
                                 increment_num_stolen_to_staged(added);
+                            increment_num_stolen_at_level(num_thread, i, added);
                             return result;
                         }
                     }
@@ -1078,6 +1279,7 @@ namespace hpx { namespace threads { namespace policies
                         queues_[idx].data_->increment_num_stolen_from_staged(
                             added);
                         this_queue->increment_num_stolen_to_staged(added);
+                        increment_num_stolen_at_level(num_thread, i, added);
                         return result;
                     }
                 }
@@ -1165,6 +1367,10 @@ namespace hpx { namespace threads { namespace policies
             std::ptrdiff_t radius = std::lround(num_threads / 2.0);
             victim_threads_[num_thread].data_.reserve(num_threads);
 
+            std::vector<std::size_t> const& victims =
+                victim_threads_[num_thread].data_;
+            steal_data& sd = steal_data_[num_thread].data_;
+
             std::size_t num_pu = rp_.get_affinity_data().get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
             mask_cref_type numa_mask = numa_masks[num_thread];
@@ -1222,6 +1428,7 @@ namespace hpx { namespace threads { namespace policies
                     return any(core_mask & core_masks[other_num_thread]);
                 }
             );
+            sd.level_end_[steal_level_core] = victims.size();
 
             // check for threads which share the same NUMA domain...
             iterate(
@@ -1232,9 +1439,12 @@ namespace hpx { namespace threads { namespace policies
                         && any(numa_mask & numa_masks[other_num_thread]);
                 }
             );
+            sd.level_end_[steal_level_numa] = victims.size();
 
-            // check for the rest and if we are NUMA aware
-            if (numa_sensitive_ != 2 && any(first_mask & pu_mask))
+            // check for the rest and if we are NUMA aware, in hierarchical
+            // mode all threads are allowed to steal across NUMA domains
+            if (numa_sensitive_ == 3 ||
+                (numa_sensitive_ != 2 && any(first_mask & pu_mask)))
             {
                 iterate(
                     [&](std::size_t other_num_thread)
@@ -1243,6 +1453,8 @@ namespace hpx { namespace threads { namespace policies
                     }
                 );
             }
+            sd.level_end_[steal_level_remote] = victims.size();
+            sd.failed_attempts_ = 0;
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1275,6 +1487,38 @@ namespace hpx { namespace threads { namespace policies
             curr_queue_.store(0);
         }
 
+    protected:
+        // return the number of victims the given thread may currently steal
+        // from, in hierarchical mode remote NUMA domains are considered only
+        // after the back-off period has expired
+        std::size_t get_num_victims(std::size_t num_thread) const
+        {
+            steal_data const& sd = steal_data_[num_thread].data_;
+            if (numa_sensitive_ == 3 &&
+                sd.failed_attempts_ < remote_steal_backoff_)
+            {
+                return sd.level_end_[steal_level_numa];
+            }
+            return sd.level_end_[steal_level_remote];
+        }
+
+        // account for work stolen from the victim at the given index
+        void increment_num_stolen_at_level(std::size_t num_thread,
+            std::size_t victim, std::size_t num = 1)
+        {
+            steal_data& sd = steal_data_[num_thread].data_;
+            sd.failed_attempts_ = 0;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            std::size_t level = steal_level_core;
+            while (victim >= sd.level_end_[level])
+                ++level;
+            sd.stolen_[level].fetch_add(num, std::memory_order_relaxed);
+#else
+            HPX_UNUSED(victim);
+            HPX_UNUSED(num);
+#endif
+        }
+
     protected:
         std::size_t max_queue_thread_count_;
         std::atomic<std::size_t> curr_queue_;
@@ -1292,6 +1536,25 @@ namespace hpx { namespace threads { namespace policies
             high_priority_queues_;
         std::vector<util::cache_line_data<std::vector<std::size_t>>>
             victim_threads_;
+
+        // per OS thread data needed for the hierarchical stealing
+        struct steal_data
+        {
+            // index into victim_threads_ after the last victim of each level
+            std::size_t level_end_[num_steal_levels];
+
+            // number of consecutive unsuccessful attempts to find work
+            std::size_t failed_attempts_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // number of items stolen from each level
+            std::atomic<std::int64_t> stolen_[num_steal_levels];
+#endif
+        };
+        std::vector<util::cache_aligned_data<steal_data>> steal_data_;
+
+        // number of unsuccessful attempts before stealing across NUMA domains
+        std::size_t const remote_steal_backoff_;
     };
 }}}
 
@@ -22,6 +22,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util_fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -279,6 +280,59 @@ namespace hpx { namespace threads { namespace policies
             num_stolen_threads += queues_[num_thread]->get_num_stolen_to_staged(reset);
             return num_stolen_threads;
         }
+
+        std::int64_t get_num_steal_batches(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t num_steal_batches = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                    num_steal_batches += queues_[i]->get_num_steal_batches(reset);
+                return num_steal_batches;
+            }
+
+            num_steal_batches += queues_[num_thread]->get_num_steal_batches(reset);
+            return num_steal_batches;
+        }
+
+        std::int64_t get_average_steal_batch_size(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t items = 0;
+            std::int64_t count = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                {
+                    items += queues_[i]->get_steal_batch_items(reset);
+                    count += queues_[i]->get_steal_batch_count(reset);
+                }
+            }
+            else
+            {
+                items += queues_[num_thread]->get_steal_batch_items(reset);
+                count += queues_[num_thread]->get_steal_batch_count(reset);
+            }
+            return count == 0 ? 0 : items / count;
+        }
+
+        std::int64_t get_max_steal_batch_size(
+            std::size_t num_thread, bool reset) override
+        {
+            std::int64_t largest = 0;
+            if (num_thread == std::size_t(-1))
+            {
+                for (std::size_t i = 0; i != queues_.size(); ++i)
+                {
+                    largest = (std::max)(largest,
+                        queues_[i]->get_largest_steal_batch(reset));
+                }
+                return largest;
+            }
+
+            return queues_[num_thread]->get_largest_steal_batch(reset);
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -402,10 +456,13 @@ namespace hpx { namespace threads { namespace policies
                             continue;
 
                         thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
+                        std::size_t stolen = queues_[num_thread]->
+                            steal_next_thread(thrd, q, running);
+                        if (stolen != 0)
                         {
-                            q->increment_num_stolen_from_pending();
-                            queues_[num_thread]->increment_num_stolen_to_pending();
+                            q->increment_num_stolen_from_pending(stolen);
+                            queues_[num_thread]->
+                                increment_num_stolen_to_pending(stolen);
                             return true;
                         }
                     }
@@ -431,10 +488,13 @@ namespace hpx { namespace threads { namespace policies
                             continue;
 
                         thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
+                        std::size_t stolen = queues_[num_thread]->
+                            steal_next_thread(thrd, q, running);
+                        if (stolen != 0)
                         {
-                            q->increment_num_stolen_from_pending();
-                            queues_[num_thread]->increment_num_stolen_to_pending();
+                            q->increment_num_stolen_from_pending(stolen);
+                            queues_[num_thread]->
+                                increment_num_stolen_to_pending(stolen);
                             return true;
                         }
                     }
@@ -452,10 +512,13 @@ namespace hpx { namespace threads { namespace policies
                     HPX_ASSERT(idx != num_thread);
 
                     thread_queue_type* q = queues_[idx];
-                    if (q->get_next_thread(thrd, running))
+                    std::size_t stolen = queues_[num_thread]->
+                        steal_next_thread(thrd, q, running);
+                    if (stolen != 0)
                     {
-                        q->increment_num_stolen_from_pending();
-                        queues_[num_thread]->increment_num_stolen_to_pending();
+                        q->increment_num_stolen_from_pending(stolen);
+                        queues_[num_thread]->
+                            increment_num_stolen_to_pending(stolen);
                         return true;
                     }
                 }
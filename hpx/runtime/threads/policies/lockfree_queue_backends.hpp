@@ -10,8 +10,10 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
 #include <hpx/util/lockfree/deque.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -219,6 +221,94 @@ struct lockfree_abp_lifo
 
 #endif // HPX_HAVE_ABP_SCHEDULER
 
+///////////////////////////////////////////////////////////////////////////////
+// LIFO for the owning OS thread + stealing at opposite end, based on the
+// Chase-Lev work-stealing deque. The owner is the first OS thread popping
+// without stealing. Only the owner's push/pop operate on the bottom end of the
+// deque (without any CAS in the common case). Items pushed by any other OS
+// thread (or pushed to the other end) are put into a separate lock-free FIFO
+// which is consulted once the deque has run empty.
+struct lockfree_chase_lev;
+
+namespace detail
+{
+    // return a unique address for the calling OS thread
+    inline void const* get_os_thread_identity()
+    {
+        static HPX_NATIVE_TLS char identity = 0;
+        return &identity;
+    }
+}
+
+template <typename T>
+struct lockfree_chase_lev_backend
+{
+    typedef boost::lockfree::chase_lev_deque<T> container_type;
+    typedef boost::lockfree::deque<T> inbox_type;
+    typedef T value_type;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::uint64_t size_type;
+
+    lockfree_chase_lev_backend(
+        size_type initial_size = 0
+      , size_type num_thread = size_type(-1)
+        )
+      : owner_(nullptr)
+      , queue_(std::size_t(initial_size))
+      , inbox_(std::size_t(initial_size))
+    {}
+
+    bool push(const_reference val, bool other_end = false)
+    {
+        if (!other_end &&
+            owner_.load(std::memory_order_relaxed) ==
+                detail::get_os_thread_identity())
+        {
+            queue_.push_bottom(val);
+            return true;
+        }
+        return inbox_.push_left(val);
+    }
+
+    bool pop(reference val, bool steal = true)
+    {
+        if (!steal && is_owner())
+            return queue_.pop_bottom(val) || inbox_.pop_right(val);
+        return queue_.steal(val) || inbox_.pop_right(val);
+    }
+
+    bool empty()
+    {
+        return queue_.empty() && inbox_.empty();
+    }
+
+  private:
+    // the first OS thread popping from the local end claims ownership
+    bool is_owner()
+    {
+        void const* self = detail::get_os_thread_identity();
+        void const* owner = owner_.load(std::memory_order_relaxed);
+        if (owner == self)
+            return true;
+        return owner == nullptr &&
+            owner_.compare_exchange_strong(owner, self);
+    }
+
+    std::atomic<void const*> owner_;
+    container_type queue_;
+    inbox_type inbox_;
+};
+
+struct lockfree_chase_lev
+{
+    template <typename T>
+    struct apply
+    {
+        typedef lockfree_chase_lev_backend<T> type;
+    };
+};
+
 }}}
 
 #endif // HPX_FB3518C8_4493_450E_A823_A9F8A3185B2D
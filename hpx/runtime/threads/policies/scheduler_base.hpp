@@ -78,12 +78,35 @@ namespace hpx { namespace threads { namespace policies
 
         void idle_callback(std::size_t num_thread);
 
+        /// This function gets called by the scheduling loop whenever it has
+        /// found work, it resets the idle back-off state of the given OS
+        /// thread.
+        void end_idle_period(std::size_t num_thread)
+        {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            idle_backoff_data& data = wait_counts_[num_thread].data_;
+            if (HPX_UNLIKELY(data.idle_))
+            {
+                data.idle_ = false;
+                data.spin_rounds_ = 0;
+                data.wait_count_ = 0;
+            }
+#else
+            (void)num_thread;
+#endif
+        }
+
         bool background_callback(std::size_t num_thread);
 
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// possibly idling OS threads. The given OS thread is woken if it is
+        /// parked, otherwise one of the other parked OS threads is woken as
+        /// the new work may be stolen.
+        void do_some_work(std::size_t num_thread);
+
+        /// Wake up all parked OS threads (used while stopping the scheduler)
+        void do_some_work_all();
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -156,6 +179,38 @@ namespace hpx { namespace threads { namespace policies
             bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(std::size_t num_thread,
             bool reset) = 0;
+
+        // number of successful steal operations, each of which might have
+        // moved a batch of items
+        virtual std::int64_t get_num_steal_batches(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+
+        // average and largest number of items moved by a steal operation
+        virtual std::int64_t get_average_steal_batch_size(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_max_steal_batch_size(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+
+        // number of items stolen from the different levels of the stealing
+        // hierarchy, only schedulers stealing hierarchically report those
+        virtual std::int64_t get_num_stolen_from_core(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t /*num_thread*/, bool /*reset*/) { return 0; }
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // number of times OS threads were parked because of being idle and
+        // number of times parked OS threads were woken up for new work
+        std::int64_t get_num_parks(std::size_t num_thread, bool reset);
+        std::int64_t get_num_unparks(std::size_t num_thread, bool reset);
+
+        // average time between new work having been announced and a parked
+        // OS thread having woken up [ns]
+        std::int64_t get_average_wake_latency(
+            std::size_t num_thread, bool reset);
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -226,15 +281,34 @@ namespace hpx { namespace threads { namespace policies
         std::vector<util::cache_line_data<std::atomic<scheduler_mode>>> modes_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        compat::condition_variable cond_;
+        // support for parking OS threads on idle queues
         struct idle_backoff_data
         {
-            std::uint32_t wait_count_;
+            idle_backoff_data();
+
+            // the following members are accessed by the owning OS thread only
+            std::uint32_t wait_count_;      // number of timed out parks
             double max_idle_backoff_time_;
+            bool idle_;                     // the OS thread is idling
+            std::uint32_t spin_rounds_;     // idle rounds spun before parking
+            std::uint32_t max_spin_rounds_; // adapted to the arrival of work
+
+            // the following members are protected by mtx_
+            pu_mutex_type mtx_;
+            compat::condition_variable cond_;
+            bool notified_;
+            std::uint64_t notify_time_;
+            std::atomic<bool> parked_;
+
+            // statistics
+            std::atomic<std::int64_t> parks_;
+            std::atomic<std::int64_t> unparks_;
+            std::atomic<std::int64_t> wake_latency_;
+            std::atomic<std::int64_t> wake_latency_count_;
         };
-        std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+        std::vector<util::cache_aligned_data<idle_backoff_data>> wait_counts_;
+        std::atomic<std::size_t> parked_count_;
+        std::uint32_t max_idle_spin_rounds_;
 #endif
 
         // support for suspension of pus
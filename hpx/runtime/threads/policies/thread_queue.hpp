@@ -11,6 +11,7 @@
 #include <hpx/compat/mutex.hpp>
 #include <hpx/error_code.hpp>
 #include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/threads/policies/edf_queue_backend.hpp>
 #include <hpx/runtime/threads/policies/lockfree_queue_backends.hpp>
 #include <hpx/runtime/threads/policies/queue_helpers.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
@@ -30,12 +31,12 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
-#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -112,6 +113,22 @@ namespace hpx { namespace threads { namespace policies
                     std::to_string(HPX_SCHEDULER_MAX_TERMINATED_THREADS)));
             return max_terminated_threads;
         }
+
+        inline bool get_lockfree_recycling()
+        {
+            static bool lockfree_recycling =
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.lockfree_recycling", "0")) != 0;
+            return lockfree_recycling;
+        }
+
+        inline int get_max_steal_batch_size()
+        {
+            static int max_steal_batch_size =
+                boost::lexical_cast<int>(hpx::get_config_entry(
+                    "hpx.thread_queue.max_steal_batch_size", "1"));
+            return max_steal_batch_size;
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -172,13 +189,29 @@ namespace hpx { namespace threads { namespace policies
         // number of terminated threads to collect before cleaning them up
         int const max_terminated_threads;
 
+        // if set, thread objects are recycled through the (lock-free) thread
+        // heaps only and the thread map is not maintained, i.e. scheduling
+        // and retiring an HPX thread never acquires mtx_, creating one holds
+        // it only while a new thread object is allocated
+        bool const lockfree_recycling;
+
+        // steal up to half of the victim's work (but not more than this
+        // amount of items) during a single steal operation
+        int const max_steal_batch_size;
+
         // this is the type of a map holding all threads (except depleted ones)
         using thread_map_type = std::unordered_set<thread_id_type,
             std::hash<thread_id_type>, std::equal_to<thread_id_type>,
             util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type =
-            std::list<thread_id_type, util::internal_allocator<thread_id_type>>;
+        // this is the type of the list of all thread objects ever allocated
+        // by this queue (used only if lockfree_recycling is set)
+        using thread_objects_type = std::vector<thread_id_type,
+            util::internal_allocator<thread_id_type>>;
+
+        // the thread heaps are per-queue lock-free LIFO free-lists of thread
+        // objects available for reuse
+        using thread_heap_type = lockfree_lifo_backend<thread_data*>;
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         typedef
@@ -204,11 +237,12 @@ namespace hpx { namespace threads { namespace policies
             apply<thread_data*>::type terminated_items_type;
 
     protected:
+        // Note: lk is expected to own mtx_ unless lockfree_recycling is set
         template <typename Lock>
         void create_thread_object(threads::thread_id_type& thrd,
             threads::thread_init_data& data, thread_state_enum state, Lock& lk)
         {
-            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(lk.owns_lock() != lockfree_recycling);
             HPX_ASSERT(data.stacksize != 0);
 
             std::ptrdiff_t stacksize = data.stacksize;
@@ -231,6 +265,10 @@ namespace hpx { namespace threads { namespace policies
             {
                 heap = &thread_heap_huge_;
             }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                heap = &thread_heap_nostack_;
+            }
             else {
                 switch(stacksize) {
                 case thread_stacksize_small:
@@ -249,6 +287,10 @@ namespace hpx { namespace threads { namespace policies
                     heap = &thread_heap_huge_;
                     break;
 
+                case thread_stacksize_nostack:
+                    heap = &thread_heap_nostack_;
+                    break;
+
                 default:
                     break;
                 }
@@ -261,19 +303,33 @@ namespace hpx { namespace threads { namespace policies
             }
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            threads::thread_data* p = nullptr;
+            if (heap->pop(p, false))
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->front();
-                heap->pop_front();
+                // The object stays visible to enumerate_threads while it is
+                // recycled, rebind() protects the inspected data using the
+                // per-object lock and bumps the generation of the object.
+                thrd = thread_id_type(p);
                 thrd->rebind(data, state);
             }
+            else if (lockfree_recycling)
+            {
+                // Allocate a new thread object and remember it, it will be
+                // recycled from now on and released only by our destructor.
+                p = thread_alloc_.allocate(1);
+                new (p) threads::thread_data(data, this, state);
+                thrd = thread_id_type(p);
+
+                std::lock_guard<mutex_type> ll(mtx_);
+                thread_objects_.push_back(thrd);
+            }
             else
             {
                 hpx::util::unlock_guard<Lock> ull(lk);
 
                 // Allocate a new thread object.
-                threads::thread_data* p = thread_alloc_.allocate(1);
+                p = thread_alloc_.allocate(1);
                 new (p) threads::thread_data(data, this, state);
                 thrd = thread_id_type(p);
             }
@@ -287,7 +343,7 @@ namespace hpx { namespace threads { namespace policies
         std::size_t add_new(std::int64_t add_count, thread_queue* addfrom,
             std::unique_lock<mutex_type> &lk, bool steal = false)
         {
-            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(lk.owns_lock() != lockfree_recycling);
 
             if (HPX_UNLIKELY(0 == add_count))
                 return 0;
@@ -317,16 +373,19 @@ namespace hpx { namespace threads { namespace policies
                 task_description_alloc_.deallocate(task, 1);
 
                 // add the new entry to the map of all threads
-                std::pair<thread_map_type::iterator, bool> p =
-                    thread_map_.insert(thrd);
-
-                if (HPX_UNLIKELY(!p.second)) {
-                    --addfrom->new_tasks_count_.data_;
-                    lk.unlock();
-                    HPX_THROW_EXCEPTION(hpx::out_of_memory,
-                        "threadmanager::add_new",
-                        "Couldn't add new thread to the thread map");
-                    return 0;
+                if (!lockfree_recycling)
+                {
+                    std::pair<thread_map_type::iterator, bool> p =
+                        thread_map_.insert(thrd);
+
+                    if (HPX_UNLIKELY(!p.second)) {
+                        --addfrom->new_tasks_count_.data_;
+                        lk.unlock();
+                        HPX_THROW_EXCEPTION(hpx::out_of_memory,
+                            "threadmanager::add_new",
+                            "Couldn't add new thread to the thread map");
+                        return 0;
+                    }
                 }
 
                 ++thread_map_count_;
@@ -344,7 +403,8 @@ namespace hpx { namespace threads { namespace policies
                 }
 
                 // this thread has to be in the map now
-                HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                HPX_ASSERT(lockfree_recycling ||
+                    thread_map_.find(thrd) != thread_map_.end());
                 HPX_ASSERT(&thrd->get_queue<thread_queue>() == this);
             }
 
@@ -358,7 +418,7 @@ namespace hpx { namespace threads { namespace policies
         bool add_new_always(std::size_t& added, thread_queue* addfrom,
             std::unique_lock<mutex_type> &lk, bool steal = false)
         {
-            HPX_ASSERT(lk.owns_lock());
+            HPX_ASSERT(lk.owns_lock() != lockfree_recycling);
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             util::tick_counter tc(add_new_time_);
@@ -369,14 +429,18 @@ namespace hpx { namespace threads { namespace policies
 
             // if we are desperate (no work in the queues), add some even if the
             // map holds more than max_count
-            if (HPX_LIKELY(max_count_)) {
-                std::size_t count = thread_map_.size();
-                if (max_count_ >= count + min_add_new_count) { //-V104
-                    HPX_ASSERT(max_count_ - count <
+            std::size_t max_count = max_count_.load(std::memory_order_relaxed);
+            if (HPX_LIKELY(max_count)) {
+                std::size_t count = lockfree_recycling ?
+                    static_cast<std::size_t>(thread_map_count_.load(
+                        std::memory_order_relaxed)) :
+                    thread_map_.size();
+                if (max_count >= count + min_add_new_count) { //-V104
+                    HPX_ASSERT(max_count - count <
                         static_cast<std::size_t>(
                             (std::numeric_limits<std::int64_t>::max)()
                         ));
-                    add_count = static_cast<std::int64_t>(max_count_ - count);
+                    add_count = static_cast<std::int64_t>(max_count - count);
                     if (add_count < min_add_new_count)
                         add_count = min_add_new_count;
                     if (add_count > max_add_new_count)
@@ -391,6 +455,17 @@ namespace hpx { namespace threads { namespace policies
                 }
             }
 
+            // when stealing, convert up to half of the victim's tasks at once
+            if (addfrom != this && max_steal_batch_size > 1 && add_count != -1)
+            {
+                std::int64_t batch_size = (std::min)(
+                    addfrom->new_tasks_count_.data_.load(
+                        std::memory_order_relaxed) / 2,
+                    std::int64_t(max_steal_batch_size));
+                if (add_count < batch_size)
+                    add_count = batch_size;
+            }
+
             std::size_t addednew = add_new(add_count, addfrom, lk, steal);
             added += addednew;
             return addednew != 0;
@@ -398,41 +473,53 @@ namespace hpx { namespace threads { namespace policies
 
         void recycle_thread(thread_id_type thrd)
         {
+            // the thread object is cached without its stack if stacks are
+            // pooled
+            thrd->release_stack();
+
             std::ptrdiff_t stacksize = thrd->get_stack_size();
 
             if (stacksize == get_stack_size(thread_stacksize_small))
             {
-                thread_heap_small_.push_front(thrd);
+                thread_heap_small_.push(thrd.get());
             }
             else if (stacksize == get_stack_size(thread_stacksize_medium))
             {
-                thread_heap_medium_.push_front(thrd);
+                thread_heap_medium_.push(thrd.get());
             }
             else if (stacksize == get_stack_size(thread_stacksize_large))
             {
-                thread_heap_large_.push_front(thrd);
+                thread_heap_large_.push(thrd.get());
             }
             else if (stacksize == get_stack_size(thread_stacksize_huge))
             {
-                thread_heap_huge_.push_front(thrd);
+                thread_heap_huge_.push(thrd.get());
+            }
+            else if (stacksize == get_stack_size(thread_stacksize_nostack))
+            {
+                thread_heap_nostack_.push(thrd.get());
             }
             else
             {
                 switch(stacksize) {
                 case thread_stacksize_small:
-                    thread_heap_small_.push_front(thrd);
+                    thread_heap_small_.push(thrd.get());
                     break;
 
                 case thread_stacksize_medium:
-                    thread_heap_medium_.push_front(thrd);
+                    thread_heap_medium_.push(thrd.get());
                     break;
 
                 case thread_stacksize_large:
-                    thread_heap_large_.push_front(thrd);
+                    thread_heap_large_.push(thrd.get());
                     break;
 
                 case thread_stacksize_huge:
-                    thread_heap_huge_.push_front(thrd);
+                    thread_heap_huge_.push(thrd.get());
+                    break;
+
+                case thread_stacksize_nostack:
+                    thread_heap_nostack_.push(thrd.get());
                     break;
 
                 default:
@@ -457,7 +544,21 @@ namespace hpx { namespace threads { namespace policies
             if (terminated_items_count_ == 0)
                 return true;
 
-            if (delete_all) {
+            if (lockfree_recycling) {
+                // all thread objects are kept alive for reuse, no locking is
+                // required
+                thread_data* todelete;
+                while (terminated_items_.pop(todelete))
+                {
+                    --terminated_items_count_;
+
+                    recycle_thread(thread_id_type(todelete));
+
+                    --thread_map_count_;
+                    HPX_ASSERT(thread_map_count_ >= 0);
+                }
+            }
+            else if (delete_all) {
                 // delete all threads
                 thread_data* todelete;
                 while (terminated_items_.pop(todelete))
@@ -513,6 +614,9 @@ namespace hpx { namespace threads { namespace policies
             if (terminated_items_count_ == 0)
                 return true;
 
+            if (lockfree_recycling)
+                return cleanup_terminated_locked(delete_all);
+
             if (delete_all) {
                 // do not lock mutex while deleting all threads, do it piece-wise
                 while (true)
@@ -545,6 +649,8 @@ namespace hpx { namespace threads { namespace policies
             max_add_new_count(detail::get_max_add_new_count()),
             max_delete_count(detail::get_max_delete_count()),
             max_terminated_threads(detail::get_max_terminated_threads()),
+            lockfree_recycling(detail::get_lockfree_recycling()),
+            max_steal_batch_size(detail::get_max_steal_batch_size()),
             thread_map_count_(0),
             work_items_(128, queue_num),
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -561,10 +667,11 @@ namespace hpx { namespace threads { namespace policies
             new_tasks_wait_(0),
             new_tasks_wait_count_(0),
 #endif
-            thread_heap_small_(),
-            thread_heap_medium_(),
-            thread_heap_large_(),
-            thread_heap_huge_(),
+            thread_heap_small_(128),
+            thread_heap_medium_(128),
+            thread_heap_large_(128),
+            thread_heap_huge_(128),
+            thread_heap_nostack_(128),
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
             add_new_time_(0),
             cleanup_terminated_time_(0),
@@ -576,6 +683,10 @@ namespace hpx { namespace threads { namespace policies
             stolen_from_staged_(0),
             stolen_to_pending_(0),
             stolen_to_staged_(0),
+            steal_batches_(0),
+            steal_batch_items_(0),
+            steal_batch_count_(0),
+            largest_steal_batch_(0),
 #endif
             add_new_logger_("thread_queue::add_new")
         {
@@ -592,17 +703,19 @@ namespace hpx { namespace threads { namespace policies
 
         ~thread_queue()
         {
-            for(auto t: thread_heap_small_)
-                deallocate(t.get());
-
-            for(auto t: thread_heap_medium_)
-                deallocate(t.get());
-
-            for(auto t: thread_heap_large_)
-                deallocate(t.get());
+            if (lockfree_recycling)
+            {
+                // all thread objects are owned by the list of thread objects
+                for (auto t : thread_objects_)
+                    deallocate(t.get());
+                return;
+            }
 
-            for(auto t: thread_heap_huge_)
-                deallocate(t.get());
+            deallocate_heap(thread_heap_small_);
+            deallocate_heap(thread_heap_medium_);
+            deallocate_heap(thread_heap_large_);
+            deallocate_heap(thread_heap_huge_);
+            deallocate_heap(thread_heap_nostack_);
         }
 
         void set_max_count(std::size_t max_count = max_thread_count)
@@ -610,6 +723,34 @@ namespace hpx { namespace threads { namespace policies
             max_count_ = (0 == max_count) ? max_thread_count : max_count; //-V105
         }
 
+    private:
+        static void deallocate_heap(thread_heap_type& heap)
+        {
+            threads::thread_data* p = nullptr;
+            while (heap.pop(p, false))
+                deallocate(p);
+        }
+
+        // Invoke f for all (non-recycled) thread objects of this queue,
+        // mtx_ has to be acquired by the caller.
+        template <typename F>
+        void for_each_thread_locked(F && f) const
+        {
+            if (lockfree_recycling)
+            {
+                for (thread_id_type const& id : thread_objects_)
+                {
+                    if (id->get_state().state() != terminated)
+                        f(id);
+                }
+                return;
+            }
+
+            for (thread_id_type const& id : thread_map_)
+                f(id);
+        }
+
+    public:
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t get_creation_time(bool reset)
         {
@@ -720,6 +861,48 @@ namespace hpx { namespace threads { namespace policies
         {
             stolen_to_staged_.fetch_add(num, std::memory_order_relaxed);
         }
+
+        std::int64_t get_num_steal_batches(bool reset)
+        {
+            return util::get_and_reset_value(steal_batches_, reset);
+        }
+
+        // the overall number of items moved and the number of steal
+        // operations used for calculating the average batch size, these are
+        // reset independently of the number of steal operations
+        std::int64_t get_steal_batch_items(bool reset)
+        {
+            return util::get_and_reset_value(steal_batch_items_, reset);
+        }
+
+        std::int64_t get_steal_batch_count(bool reset)
+        {
+            return util::get_and_reset_value(steal_batch_count_, reset);
+        }
+
+        std::int64_t get_largest_steal_batch(bool reset)
+        {
+            return util::get_and_reset_value(largest_steal_batch_, reset);
+        }
+
+        // account for a successful steal operation which moved the given
+        // number of items
+        void add_steal_batch(std::size_t size)
+        {
+            std::int64_t const batch_size = static_cast<std::int64_t>(size);
+
+            steal_batches_.fetch_add(1, std::memory_order_relaxed);
+            steal_batch_items_.fetch_add(batch_size, std::memory_order_relaxed);
+            steal_batch_count_.fetch_add(1, std::memory_order_relaxed);
+
+            std::int64_t largest =
+                largest_steal_batch_.load(std::memory_order_relaxed);
+            while (largest < batch_size &&
+                !largest_steal_batch_.compare_exchange_weak(
+                    largest, batch_size, std::memory_order_relaxed))
+            {
+            }
+        }
 #else
         HPX_CXX14_CONSTEXPR void increment_num_pending_misses(
             std::size_t num = 1)
@@ -745,6 +928,9 @@ namespace hpx { namespace threads { namespace policies
             std::size_t num = 1)
         {
         }
+        HPX_CXX14_CONSTEXPR void add_steal_batch(std::size_t size)
+        {
+        }
 #endif
 
         ///////////////////////////////////////////////////////////////////////
@@ -764,25 +950,31 @@ namespace hpx { namespace threads { namespace policies
                 // created, as it might have that the current HPX thread gets
                 // suspended.
                 {
-                    std::unique_lock<mutex_type> lk(mtx_);
+                    std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                    if (!lockfree_recycling)
+                        lk.lock();
 
                     create_thread_object(thrd, data, initial_state, lk);
 
                     // add a new entry in the map for this thread
-                    std::pair<thread_map_type::iterator, bool> p =
-                        thread_map_.insert(thrd);
-
-                    if (HPX_UNLIKELY(!p.second)) {
-                        lk.unlock();
-                        HPX_THROWS_IF(ec, hpx::out_of_memory,
-                            "threadmanager::register_thread",
-                            "Couldn't add new thread to the map of threads");
-                        return;
+                    if (!lockfree_recycling)
+                    {
+                        std::pair<thread_map_type::iterator, bool> p =
+                            thread_map_.insert(thrd);
+
+                        if (HPX_UNLIKELY(!p.second)) {
+                            lk.unlock();
+                            HPX_THROWS_IF(ec, hpx::out_of_memory,
+                                "threadmanager::register_thread",
+                                "Couldn't add new thread to the map of threads");
+                            return;
+                        }
                     }
                     ++thread_map_count_;
 
                     // this thread has to be in the map now
-                    HPX_ASSERT(thread_map_.find(thrd) != thread_map_.end());
+                    HPX_ASSERT(lockfree_recycling ||
+                        thread_map_.find(thrd) != thread_map_.end());
                     HPX_ASSERT(&thrd->get_queue<thread_queue>() == this);
 
                     // push the new thread in the pending queue thread
@@ -837,6 +1029,33 @@ namespace hpx { namespace threads { namespace policies
             }
         }
 
+        // move up to count pending threads from the given queue to this one,
+        // returns the number of moved threads
+        std::size_t steal_work_items_from(thread_queue* src,
+            std::int64_t count)
+        {
+            std::size_t moved = 0;
+            thread_description* trd;
+            while (count-- > 0 && src->work_items_.pop(trd, true))
+            {
+                --src->work_items_count_.data_;
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                if (maintain_queue_wait_times) {
+                    std::uint64_t now = util::high_resolution_clock::now();
+                    src->work_items_wait_ += now - util::get<1>(*trd);
+                    ++src->work_items_wait_count_;
+                    util::get<1>(*trd) = now;
+                }
+#endif
+
+                ++work_items_count_.data_;
+                work_items_.push(trd);
+                ++moved;
+            }
+            return moved;
+        }
+
         void move_task_items_from(thread_queue *src,
             std::int64_t count)
         {
@@ -910,6 +1129,31 @@ namespace hpx { namespace threads { namespace policies
             return false;
         }
 
+        /// Steal the next thread to be executed from the given queue. If
+        /// max_steal_batch_size is larger than one, up to half of the pending
+        /// threads of the victim are moved to this queue in the same step.
+        /// Returns the overall number of stolen threads.
+        std::size_t steal_next_thread(threads::thread_data*& thrd,
+            thread_queue* victim, bool allow_stealing = true) HPX_HOT
+        {
+            std::int64_t victim_count =
+                victim->work_items_count_.data_.load(std::memory_order_relaxed);
+
+            if (!victim->get_next_thread(thrd, allow_stealing, true))
+                return 0;
+
+            std::size_t stolen = 1;
+            if (max_steal_batch_size > 1 && victim_count > 3)
+            {
+                std::int64_t batch_size = (std::min)(
+                    victim_count / 2, std::int64_t(max_steal_batch_size));
+                stolen += steal_work_items_from(victim, batch_size - 1);
+            }
+
+            add_steal_batch(stolen);
+            return stolen;
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd, bool other_end = false)
         {
@@ -955,13 +1199,12 @@ namespace hpx { namespace threads { namespace policies
             std::lock_guard<mutex_type> lk(mtx_);
 
             std::int64_t num_threads = 0;
-            thread_map_type::const_iterator end = thread_map_.end();
-            for (thread_map_type::const_iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == state)
-                    ++num_threads;
-            }
+            for_each_thread_locked(
+                [&](thread_id_type const& id)
+                {
+                    if (id->get_state().state() == state)
+                        ++num_threads;
+                });
             return num_threads;
         }
 
@@ -969,16 +1212,15 @@ namespace hpx { namespace threads { namespace policies
         void abort_all_suspended_threads()
         {
             std::lock_guard<mutex_type> lk(mtx_);
-            thread_map_type::iterator end =  thread_map_.end();
-            for (thread_map_type::iterator it = thread_map_.begin();
-                 it != end; ++it)
-            {
-                if ((*it)->get_state().state() == suspended)
+            for_each_thread_locked(
+                [this](thread_id_type const& id)
                 {
-                    (*it)->set_state(pending, wait_abort);
-                    schedule_thread((*it).get());
-                }
-            }
+                    if (id->get_state().state() == suspended)
+                    {
+                        id->set_state(pending, wait_abort);
+                        schedule_thread(id.get());
+                    }
+                });
         }
 
         bool enumerate_threads(
@@ -998,35 +1240,39 @@ namespace hpx { namespace threads { namespace policies
                 return false;
             }
 
-            std::vector<thread_id_type> ids;
+            // remember the generation of each of the thread objects as the
+            // objects may be recycled once mtx_ has been released
+            std::vector<std::pair<thread_id_type, std::size_t> > ids;
             ids.reserve(static_cast<std::size_t>(count));
 
             if (state == unknown)
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    ids.push_back(*it);
-                }
+                for_each_thread_locked(
+                    [&](thread_id_type const& id)
+                    {
+                        ids.emplace_back(id, id->get_generation());
+                    });
             }
             else
             {
                 std::lock_guard<mutex_type> lk(mtx_);
-                thread_map_type::const_iterator end =  thread_map_.end();
-                for (thread_map_type::const_iterator it = thread_map_.begin();
-                     it != end; ++it)
-                {
-                    if ((*it)->get_state().state() == state)
-                        ids.push_back(*it);
-                }
+                for_each_thread_locked(
+                    [&](thread_id_type const& id)
+                    {
+                        if (id->get_state().state() == state)
+                            ids.emplace_back(id, id->get_generation());
+                    });
             }
 
-            // now invoke callback function for all matching threads
-            for (thread_id_type const& id : ids)
+            // now invoke callback function for all matching threads, skip
+            // the ones which were recycled for a new thread in the meantime
+            for (auto const& p : ids)
             {
-                if (!f(id))
+                if (p.first->get_generation() != p.second)
+                    continue;
+
+                if (!f(p.first))
                     return false;       // stop iteration
             }
 
@@ -1044,6 +1290,12 @@ namespace hpx { namespace threads { namespace policies
                 return true;
             }
 
+            if (lockfree_recycling)
+            {
+                std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                return add_new_always(added, this, lk);
+            }
+
             // No obvious work has to be done, so a lock won't hurt too much.
             //
             // We prefer to exit this function (some kind of very short
@@ -1088,11 +1340,12 @@ namespace hpx { namespace threads { namespace policies
                 // just falls through to the cleanup work below (no work is available)
                 // in which case the current thread (which failed to acquire
                 // the lock) will just retry to enter this loop.
-                std::unique_lock<mutex_type> lk(mtx_, std::try_to_lock);
-                if (!lk.owns_lock())
+                std::unique_lock<mutex_type> lk(mtx_, std::defer_lock);
+                if (!lockfree_recycling && !lk.try_lock())
                     return false;            // avoid long wait on lock
 
                 // stop running after all HPX threads have been terminated
+                std::size_t const added_before = added;
                 bool added_new = add_new_always(added, addfrom, lk, steal);
                 if (!added_new) {
                     // Before exiting each of the OS threads deletes the
@@ -1108,6 +1361,8 @@ namespace hpx { namespace threads { namespace policies
                 }
                 else
                 {
+                    if (addfrom != this)
+                        add_steal_batch(added - added_before);
                     cleanup_terminated_locked();
                     return false;
                 }
@@ -1132,6 +1387,11 @@ namespace hpx { namespace threads { namespace policies
 #else
             if (minimal_deadlock_detection) {
                 std::lock_guard<mutex_type> lk(mtx_);
+                if (lockfree_recycling)
+                {
+                    return detail::dump_suspended_threads(num_thread,
+                        thread_objects_, idle_loop_count, running);
+                }
                 return detail::dump_suspended_threads(num_thread, thread_map_
                   , idle_loop_count, running);
             }
@@ -1150,6 +1410,9 @@ namespace hpx { namespace threads { namespace policies
         thread_map_type thread_map_;        // mapping of thread id's to HPX-threads
         std::atomic<std::int64_t> thread_map_count_; // overall count of work items
 
+        thread_objects_type thread_objects_;  // all thread objects (only if
+                                              // lockfree_recycling is set)
+
         work_items_type work_items_;        // list of active work items
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -1160,7 +1423,8 @@ namespace hpx { namespace threads { namespace policies
         terminated_items_type terminated_items_;    // list of terminated threads
         std::atomic<std::int64_t> terminated_items_count_; // count of terminated items
 
-        std::size_t max_count_;     // maximum number of existing HPX-threads
+        std::atomic<std::size_t> max_count_;  // maximum number of existing
+                                              // HPX-threads
         task_items_type new_tasks_; // list of new tasks to run
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -1172,6 +1436,7 @@ namespace hpx { namespace threads { namespace policies
         thread_heap_type thread_heap_medium_;
         thread_heap_type thread_heap_large_;
         thread_heap_type thread_heap_huge_;
+        thread_heap_type thread_heap_nostack_;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
@@ -1193,6 +1458,14 @@ namespace hpx { namespace threads { namespace policies
         std::atomic<std::int64_t> stolen_to_pending_;
         // count of new_tasks stolen to this queue from other queues
         std::atomic<std::int64_t> stolen_to_staged_;
+        // count of successful steal operations performed for this queue
+        std::atomic<std::int64_t> steal_batches_;
+        // overall number of items moved by steal operations and the number
+        // of those operations (for the average batch size)
+        std::atomic<std::int64_t> steal_batch_items_;
+        std::atomic<std::int64_t> steal_batch_count_;
+        // largest number of items moved by a single steal operation
+        std::atomic<std::int64_t> largest_steal_batch_;
 #endif
 
         util::block_profiler<add_new_tag> add_new_logger_;
@@ -447,6 +447,16 @@ namespace hpx { namespace threads
             priority_ = priority;
         }
 
+        // the absolute deadline of this thread (see thread_init_data)
+        std::uint64_t get_deadline() const
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline)
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const
         {
@@ -550,6 +560,13 @@ namespace hpx { namespace threads
         }
 #endif
 
+        /// Return the number of times this thread object was rebound, this
+        /// allows to detect whether the object was recycled in the meantime
+        std::size_t get_generation() const
+        {
+            return generation_.load(std::memory_order_acquire);
+        }
+
         void rebind(thread_init_data& init_data,
             thread_state_enum newstate)
         {
@@ -565,6 +582,12 @@ namespace hpx { namespace threads
             HPX_ASSERT(coroutine_.is_ready());
         }
 
+        /// Return the stack of this (terminated) thread to the stack pool
+        void release_stack()
+        {
+            coroutine_.release_stack();
+        }
+
         /// This function will be called when the thread is about to be deleted
         //virtual void reset() {}
 
@@ -572,6 +595,7 @@ namespace hpx { namespace threads
         thread_data(thread_init_data& init_data,
             void* queue, thread_state_enum newstate)
           : current_state_(thread_state(newstate, wait_signaled)),
+            generation_(0),
 #ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
             component_id_(init_data.lva),
 #endif
@@ -591,6 +615,7 @@ namespace hpx { namespace threads
             backtrace_(nullptr),
 #endif
             priority_(init_data.priority),
+            deadline_(init_data.deadline),
             requested_interrupt_(false),
             enabled_interrupt_(true),
             ran_exit_funcs_(false),
@@ -634,10 +659,20 @@ namespace hpx { namespace threads
 #ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
             component_id_ = init_data.lva;
 #endif
+            // the object may be inspected concurrently (e.g. by
+            // enumerate_threads), protect the data which is guarded by the
+            // per-object lock in the accessors
+            {
+                mutex_type::scoped_lock l(this);
+                generation_.fetch_add(1, std::memory_order_release);
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            description_ = (init_data.description);
-            lco_description_ = util::thread_description();
+                description_ = (init_data.description);
+                lco_description_ = util::thread_description();
+#endif
+#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
+                backtrace_ = nullptr;
 #endif
+            }
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
             parent_locality_id_ = init_data.parent_locality_id;
             parent_thread_id_ = init_data.parent_id;
@@ -645,11 +680,9 @@ namespace hpx { namespace threads
 #endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
             set_marked_state(unknown);
-#endif
-#ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
-            backtrace_ = nullptr;
 #endif
             priority_ = init_data.priority;
+            deadline_ = init_data.deadline;
             requested_interrupt_ = false;
             enabled_interrupt_ = true;
             ran_exit_funcs_ = false;
@@ -682,6 +715,9 @@ namespace hpx { namespace threads
 
         mutable std::atomic<thread_state> current_state_;
 
+        // number of times this thread object was rebound
+        std::atomic<std::size_t> generation_;
+
         ///////////////////////////////////////////////////////////////////////
         // Debugging/logging information
 #ifdef HPX_HAVE_THREAD_TARGET_ADDRESS
@@ -713,6 +749,7 @@ namespace hpx { namespace threads
 
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
@@ -100,6 +100,11 @@ namespace hpx { namespace threads
     /// current thread (or zero if the current thread is not a HPX thread).
     HPX_API_EXPORT std::size_t get_self_stacksize();
 
+    /// The function \a is_self_stackless returns whether the current thread
+    /// is a stackless HPX thread, i.e. a thread which is not allowed to
+    /// suspend (or false if the current thread is not a HPX thread).
+    HPX_API_EXPORT bool is_self_stackless();
+
     /// The function \a get_parent_locality_id returns the id of the locality of
     /// the current thread's parent (or zero if the current thread is not a
     /// HPX thread).
@@ -716,6 +716,10 @@ namespace hpx { namespace this_thread
     // requested
     HPX_EXPORT bool has_sufficient_stack_space(
         std::size_t space_needed = 8 * HPX_THREADS_STACK_OVERHEAD);
+
+    // returns the number of items queued for the worker thread running the
+    // calling HPX thread (zero if called outside of an HPX thread)
+    HPX_EXPORT std::int64_t get_local_queue_length();
     /// \endcond
 }}
 
@@ -26,6 +26,9 @@ namespace hpx { namespace threads
     HPX_API_EXPORT std::ptrdiff_t get_default_stack_size();
     HPX_API_EXPORT std::ptrdiff_t get_stack_size(thread_stacksize);
 
+    // deadline value used for threads without a deadline
+    HPX_CONSTEXPR_OR_CONST std::uint64_t no_deadline = std::uint64_t(-1);
+
     ///////////////////////////////////////////////////////////////////////////
     class thread_init_data
     {
@@ -47,6 +50,7 @@ namespace hpx { namespace threads
             priority(thread_priority_normal),
             schedulehint(),
             stacksize(get_default_stack_size()),
+            deadline(no_deadline),
             scheduler_base(nullptr)
         {}
 
@@ -55,6 +59,7 @@ namespace hpx { namespace threads
             priority        = rhs.priority;
             schedulehint    = rhs.schedulehint;
             stacksize       = rhs.stacksize;
+            deadline        = rhs.deadline;
             scheduler_base  = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_TARGET_ADDRESS)
             lva = rhs.lva;
@@ -95,6 +100,7 @@ namespace hpx { namespace threads
             priority(rhs.priority),
             schedulehint(rhs.schedulehint),
             stacksize(rhs.stacksize),
+            deadline(rhs.deadline),
             scheduler_base(rhs.scheduler_base)
         {
             if (stacksize == 0)
@@ -126,6 +132,7 @@ namespace hpx { namespace threads
             priority(priority_), schedulehint(os_thread),
             stacksize(stacksize_ == std::ptrdiff_t(-1) ?
                 get_default_stack_size() : stacksize_),
+            deadline(no_deadline),
             scheduler_base(scheduler_base_)
         {
             if (stacksize == 0)
@@ -155,6 +162,12 @@ namespace hpx { namespace threads
         thread_schedule_hint schedulehint;
         std::ptrdiff_t stacksize;
 
+        // The absolute deadline of the new thread (in nanoseconds as returned
+        // by util::high_resolution_clock::now()). Schedulers supporting
+        // deadlines (--hpx:queuing=edf) run threads with earlier deadlines
+        // first.
+        std::uint64_t deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }}
@@ -274,6 +274,27 @@ namespace hpx { namespace threads
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_steal_batches(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_average_steal_batch_size(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_max_steal_batch_size(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_core(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        virtual std::int64_t get_num_parks(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_num_unparks(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
+        virtual std::int64_t get_average_wake_latency(
+            std::size_t /*thread_num*/, bool /*reset*/) { return 0; }
 #endif
 
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
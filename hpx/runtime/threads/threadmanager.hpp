@@ -430,6 +430,18 @@ namespace hpx { namespace threads
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+        std::int64_t get_num_steal_batches(bool reset);
+        std::int64_t get_average_steal_batch_size(bool reset);
+        std::int64_t get_max_steal_batch_size(bool reset);
+        std::int64_t get_num_stolen_from_core(bool reset);
+        std::int64_t get_num_stolen_from_numa_domain(bool reset);
+        std::int64_t get_num_stolen_from_remote_numa_domain(bool reset);
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_num_parks(bool reset);
+        std::int64_t get_num_unparks(bool reset);
+        std::int64_t get_average_wake_latency(bool reset);
 #endif
 
 private:
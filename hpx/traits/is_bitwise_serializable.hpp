@@ -7,14 +7,62 @@
 #define HPX_TRAITS_IS_BITWISE_SERIALIZABLE_HPP
 
 #include <hpx/config.hpp>
+#include <hpx/runtime/serialization/access.hpp>
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace traits
 {
+    namespace detail
+    {
+        template <typename T, typename Enable = void>
+        struct is_bitwise_serializable_default
+          : std::is_arithmetic<T>
+        {};
+
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+        // Trivially copyable classes which have no other way of being
+        // serialized (neither a serialize function of their own nor being
+        // handled by serialize_struct) are serialized as a whole. Use
+        // HPX_IS_NOT_BITWISE_SERIALIZABLE(T) to opt out (e.g. for classes
+        // holding pointers).
+        template <typename T>
+        struct is_bitwise_serializable_default<T,
+                typename std::enable_if<std::is_class<T>::value>::type>
+          : std::integral_constant<bool,
+                std::is_trivially_copyable<T>::value &&
+               !std::is_empty<T>::value &&
+               !serialization::has_serialize_function<T>::value &&
+               !serialization::is_struct_serializable<T>::value>
+        {};
+#endif
+    }
+
+    // Classes which can be serialized member by member are bitwise
+    // serializable only if marked using HPX_IS_BITWISE_SERIALIZABLE(T). They
+    // are serialized member by member if array optimizations are disabled or
+    // if the endianess of the archive differs.
     template <typename T>
     struct is_bitwise_serializable
-      : std::is_arithmetic<T>
+      : detail::is_bitwise_serializable_default<T>
+    {};
+
+    // arrays and pairs of bitwise serializable types are bitwise
+    // serializable as well
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<std::array<T, N> >
+      : is_bitwise_serializable<typename std::remove_const<T>::type>
+    {};
+
+    template <typename T1, typename T2>
+    struct is_bitwise_serializable<std::pair<T1, T2> >
+      : std::integral_constant<bool,
+            is_bitwise_serializable<typename std::remove_const<T1>::type>::value
+         && is_bitwise_serializable<typename std::remove_const<T2>::type>::value
+        >
     {};
 }}
 
@@ -27,4 +75,13 @@ namespace hpx { namespace traits {                                            \
 }}                                                                            \
 /**/
 
+#define HPX_IS_NOT_BITWISE_SERIALIZABLE(T)                                    \
+namespace hpx { namespace traits {                                            \
+    template <>                                                               \
+    struct is_bitwise_serializable< T >                                       \
+      : std::false_type                                                       \
+    {};                                                                       \
+}}                                                                            \
+/**/
+
 #endif /*HPX_TRAITS_IS_BITWISE_SERIALIZABLE_HPP*/
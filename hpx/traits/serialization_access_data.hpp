@@ -15,10 +15,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 namespace hpx { namespace traits
 {
+    template <typename Container>
+    struct serialization_access_data;
+
     ///////////////////////////////////////////////////////////////////////
     template <typename Container>
     struct default_serialization_access_data
@@ -50,6 +54,24 @@ namespace hpx { namespace traits
         {
         }
 
+        // the container never has to move its data
+        HPX_CONSTEXPR static std::size_t capacity(Container& cont)
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        // Containers which can't shrink keep their size, the filtered data
+        // ends at the given size in any case. The size is only ever extended
+        // using resize().
+        static void truncate(Container& cont, std::size_t size)
+        {
+            typedef serialization_access_data<Container> access_traits;
+
+            std::size_t current = access_traits::size(cont);
+            if (current < size)
+                access_traits::resize(cont, size - current);
+        }
+
         static bool flush(serialization::binary_filter* filter,
             Container& cont, std::size_t current, std::size_t size,
             std::size_t& written)
@@ -90,6 +112,16 @@ namespace hpx { namespace traits
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(Container& cont, std::size_t size)
+        {
+            return cont.resize(size);
+        }
+
+        static std::size_t capacity(Container& cont)
+        {
+            return cont.capacity();
+        }
+
         static void write(Container& cont, std::size_t count,
             std::size_t current, void const* address)
         {
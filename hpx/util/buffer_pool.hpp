@@ -6,66 +6,155 @@
 #if !defined(HPX_UTIL_BUFFER_POOL_HPP)
 #define HPX_UTIL_BUFFER_POOL_HPP
 
+#include <hpx/config.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace util {
 
-    // This class holds shared_ptr of vector<T, Allocator> with a power of two
+    // This class holds vector<T, Allocator> with a power of two capacity,
+    // grouped by their capacity (size class). The pool is thread-safe.
+    // It keeps at most the given number of buffers per size class and the
+    // given number of bytes overall, buffers larger than that are freed.
     template <typename T, typename Allocator = std::allocator<T> >
     struct buffer_pool
+      : std::enable_shared_from_this<buffer_pool<T, Allocator> >
     {
         typedef std::vector<T, Allocator> buffer_type;
         typedef std::shared_ptr<buffer_type> shared_buffer_type;
         typedef typename buffer_type::size_type size_type;
-        typedef std::map<size_type, std::list<shared_buffer_type> > buffer_map_type;
+        typedef std::map<size_type, std::list<std::unique_ptr<buffer_type> > >
+            buffer_map_type;
+
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        explicit buffer_pool(std::size_t max_cached_buffers = 16,
+                std::size_t max_cached_bytes = 64 * 1024 * 1024)
+          : cached_bytes_(0)
+          , max_cached_buffers_(max_cached_buffers)
+          , max_cached_bytes_(max_cached_bytes)
+          , allocations_(0)
+          , reuses_(0)
+        {}
 
+        // Return an empty buffer with at least the given capacity, the
+        // buffer is owned by the caller.
         shared_buffer_type get_buffer(size_type size)
+        {
+            return shared_buffer_type(get(size).release());
+        }
+
+        // Return a buffer of the given size, which is handed back to the
+        // pool once the last reference to it has been released. The pool
+        // has to be managed by a shared_ptr.
+        shared_buffer_type get_pooled_buffer(size_type size)
+        {
+            std::unique_ptr<buffer_type> buffer = get(size);
+            buffer->resize(size);
+
+            std::shared_ptr<buffer_pool> pool = this->shared_from_this();
+            return shared_buffer_type(buffer.release(),
+                [pool](buffer_type* p)
+                {
+                    pool->reclaim(std::unique_ptr<buffer_type>(p));
+                });
+        }
+
+        void reclaim_buffer(shared_buffer_type buffer)
+        {
+            std::unique_ptr<buffer_type> b(new buffer_type());
+            b->swap(*buffer);
+            reclaim(std::move(b));
+        }
+
+        void clear()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            buffers_.clear();
+            cached_bytes_ = 0;
+        }
+
+        // number of buffers which had to be newly allocated
+        std::int64_t get_allocation_count(bool reset)
+        {
+            return reset ? allocations_.exchange(0) : allocations_.load();
+        }
+
+        // number of buffers which were served from the pool
+        std::int64_t get_reuse_count(bool reset)
+        {
+            return reset ? reuses_.exchange(0) : reuses_.load();
+        }
+
+    private:
+        std::unique_ptr<buffer_type> get(size_type size)
         {
             size_type capacity = next_power_of_two(size);
-            typename buffer_map_type::iterator it = buffers_.find(capacity);
-            shared_buffer_type res;
-            if(it == buffers_.end() || it->second.empty())
-            {
-                res.reset(new buffer_type());
-                res->reserve(capacity);
-            }
-            else
             {
-                res = it->second.front();
-                it->second.pop_front();
+                std::lock_guard<mutex_type> l(mtx_);
+                typename buffer_map_type::iterator it = buffers_.find(capacity);
+                if (it != buffers_.end() && !it->second.empty())
+                {
+                    std::unique_ptr<buffer_type> res =
+                        std::move(it->second.front());
+                    it->second.pop_front();
+                    cached_bytes_ -= capacity * sizeof(T);
+                    ++reuses_;
+                    return res;
+                }
             }
+
+            std::unique_ptr<buffer_type> res(new buffer_type());
+            res->reserve(capacity);
+            ++allocations_;
             return res;
         }
 
-        void reclaim_buffer(shared_buffer_type buffer)
+        void reclaim(std::unique_ptr<buffer_type> buffer)
         {
             size_type capacity = next_power_of_two(buffer->capacity());
+            std::size_t bytes = capacity * sizeof(T);
+
+            // don't bother keeping buffers which can't be cached anyways
+            if (bytes > max_cached_bytes_)
+                return;
+
             buffer->clear();
-            if(capacity != buffer->capacity())
+            if (capacity != buffer->capacity())
             {
                 buffer->reserve(capacity);
             }
 
-            typename buffer_map_type::iterator it = buffers_.find(capacity);
-            if(it == buffers_.end())
+            std::lock_guard<mutex_type> l(mtx_);
+            if (cached_bytes_ + bytes > max_cached_bytes_)
+                return;
+
+            std::list<std::unique_ptr<buffer_type> >& buffers =
+                buffers_[capacity];
+            if (buffers.size() < max_cached_buffers_)
             {
-                it = buffers_.insert(it, std::make_pair(capacity,
-                    std::list<shared_buffer_type>()));
+                buffers.push_back(std::move(buffer));
+                cached_bytes_ += bytes;
             }
-            it->second.push_back(buffer);
-        }
-
-        void clear()
-        {
-            buffers_.clear();
         }
 
-    private:
+        mutex_type mtx_;
         buffer_map_type buffers_;
+        std::size_t cached_bytes_;
+        std::size_t max_cached_buffers_;
+        std::size_t max_cached_bytes_;
+
+        std::atomic<std::int64_t> allocations_;
+        std::atomic<std::int64_t> reuses_;
 
         static size_type next_power_of_two(size_type size)
         {
@@ -64,6 +64,9 @@ namespace util {
         friend struct detail::save_funct_obj;
         template <typename T, typename... Ts>
         friend void restore_checkpoint(checkpoint const& c, T& t, Ts&... ts);
+        // defined in hpx/util/incremental_checkpoint.hpp
+        friend inline checkpoint apply_checkpoint_deltas(
+            checkpoint const& base, std::vector<checkpoint> const& deltas);
 
     public:
         checkpoint() = default;
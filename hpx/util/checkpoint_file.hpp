@@ -0,0 +1,311 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/util/checkpoint_file.hpp
+///
+/// This header defines a file format for checkpoints consisting of named
+/// sections. Sections are serialized and written in parallel, trivially
+/// copyable arrays are stored aligned in the file so that they can be used
+/// directly from a memory mapping of the file when it is restored.
+
+#if !defined(HPX_UTIL_CHECKPOINT_FILE_HPP)
+#define HPX_UTIL_CHECKPOINT_FILE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+#include <hpx/util/iterator_range.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes a section of a checkpoint file
+    struct checkpoint_section_info
+    {
+        checkpoint_section_info()
+          : version_(0), offset_(0), size_(0), element_size_(0)
+        {}
+
+        std::string name_;
+        std::uint32_t version_;         ///< schema version of the section
+        std::string compression_;       ///< binary filter used, if any
+        std::uint64_t offset_;          ///< offset of the data in the file
+        std::uint64_t size_;            ///< size of the data in the file
+        std::uint64_t element_size_;    ///< zero for serialized sections
+
+        /// Return whether the section holds a trivially copyable array
+        bool is_array() const
+        {
+            return element_size_ != 0;
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar & name_ & version_ & compression_ & offset_ & size_ &
+                element_size_;
+        }
+    };
+
+    namespace detail
+    {
+        // Serialize the given objects into a new buffer, compressing it using
+        // the named binary filter if one is given
+        template <typename... Ts>
+        std::vector<char> save_checkpoint_section(
+            std::string const& compression, Ts const&... ts)
+        {
+            std::unique_ptr<serialization::binary_filter> filter;
+            if (!compression.empty())
+            {
+                filter.reset(
+                    hpx::create_binary_filter(compression.c_str(), true));
+            }
+
+            std::vector<char> data;
+            {
+                std::uint32_t const flags = filter ?
+                    serialization::enable_compression :
+                    serialization::no_archive_flags;
+                hpx::serialization::output_archive ar(
+                    data, flags, nullptr, filter.get());
+
+                int const sequencer[] = {0, (ar << ts, 0)...};
+                (void) sequencer;
+
+                ar.flush();
+            }
+            return data;
+        }
+
+        // The (read-only) data of a section of a mapped checkpoint file, as
+        // seen by the input archive
+        struct checkpoint_section_data
+        {
+            checkpoint_section_data(char const* data, std::size_t size)
+              : data_(data), size_(size)
+            {}
+
+            char const& operator[](std::size_t i) const
+            {
+                return data_[i];
+            }
+
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Collects the sections of a checkpoint and writes them to a file.
+    ///
+    /// Serialized sections are created asynchronously as soon as they are
+    /// added, arrays are written directly from the memory they were given
+    /// in. All objects handed to the writer have to stay alive (and must not
+    /// be modified) until the future returned from \a write has become
+    /// ready.
+    class HPX_EXPORT checkpoint_file_writer
+    {
+    public:
+        /// \param alignment  The alignment of the sections in the file, has
+        ///                   to be a power of two. Using the page size
+        ///                   allows to map arrays without copying them.
+        explicit checkpoint_file_writer(std::size_t alignment = 4096);
+
+        /// Add a section holding the serialized objects \a t, \a ts...
+        ///
+        /// \param name       The (unique) name of the section.
+        /// \param version    The schema version of the section, will be
+        ///                   reported back when restoring the section.
+        template <typename T, typename... Ts>
+        void add_section(std::string const& name, std::uint32_t version,
+            T const& t, Ts const&... ts)
+        {
+            add_compressed_section(name, version, std::string(), t, ts...);
+        }
+
+        /// Add a section holding the serialized objects \a t, \a ts...,
+        /// compressed by the binary filter plugin \a compression (e.g.
+        /// "lz4_serialization_filter").
+        template <typename T, typename... Ts>
+        void add_compressed_section(std::string const& name,
+            std::uint32_t version, std::string const& compression,
+            T const& t, Ts const&... ts)
+        {
+            add_serialized_section(name, version, compression,
+                hpx::async(
+                    [compression, &t, &ts...]() -> std::vector<char>
+                    {
+                        return detail::save_checkpoint_section(
+                            compression, t, ts...);
+                    }));
+        }
+
+        /// Add a section holding \a count elements starting at \a data. The
+        /// elements are stored as they are, aligned in the file.
+        template <typename T>
+        void add_array(std::string const& name, std::uint32_t version,
+            T const* data, std::size_t count)
+        {
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+            static_assert(std::is_trivially_copyable<T>::value,
+                "only arrays of trivially copyable types can be stored as "
+                "checkpoint arrays");
+#else
+            static_assert(hpx::traits::is_bitwise_serializable<T>::value,
+                "only arrays of bitwise serializable types can be stored as "
+                "checkpoint arrays");
+#endif
+            add_array_section(name, version, data, sizeof(T), count);
+        }
+
+        template <typename T, typename Allocator>
+        void add_array(std::string const& name, std::uint32_t version,
+            std::vector<T, Allocator> const& v)
+        {
+            add_array(name, version, v.data(), v.size());
+        }
+
+        /// Write all sections to the file \a filename once they have been
+        /// serialized, the sections are written in parallel. The writer
+        /// is empty afterwards.
+        hpx::future<void> write(std::string const& filename);
+
+    private:
+        void add_serialized_section(std::string const& name,
+            std::uint32_t version, std::string const& compression,
+            hpx::future<std::vector<char> >&& data);
+
+        void add_array_section(std::string const& name,
+            std::uint32_t version, void const* data,
+            std::size_t element_size, std::size_t count);
+
+        struct section;
+
+        std::size_t alignment_;
+        std::vector<std::shared_ptr<section> > sections_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Gives access to the sections of a checkpoint file written by a
+    /// checkpoint_file_writer. The file is mapped into memory, arrays are
+    /// returned as ranges referring to the mapping and stay valid as long as
+    /// the checkpoint_file object is alive. All functions may be called
+    /// concurrently, which allows to restore independent sections in
+    /// parallel.
+    class HPX_EXPORT checkpoint_file
+    {
+    public:
+        /// Map the file \a filename and read its index, throws if the file
+        /// does not exist or is not a checkpoint file of a supported format
+        explicit checkpoint_file(std::string const& filename);
+        ~checkpoint_file();
+
+        checkpoint_file(checkpoint_file const&) = delete;
+        checkpoint_file& operator=(checkpoint_file const&) = delete;
+
+        /// The sections stored in the file
+        std::vector<checkpoint_section_info> const& sections() const
+        {
+            return sections_;
+        }
+
+        bool has_section(std::string const& name) const;
+
+        /// Return the description of the section \a name, throws if there
+        /// is no such section
+        checkpoint_section_info const& get_section_info(
+            std::string const& name) const;
+
+        /// Restore the objects stored in the serialized section \a name,
+        /// the objects have to be given in the same order as they were
+        /// added to the section
+        template <typename T, typename... Ts>
+        void restore_section(std::string const& name, T& t, Ts&... ts) const
+        {
+            detail::checkpoint_section_data data =
+                get_serialized_section(name);
+
+            hpx::serialization::input_archive ar(data, data.size());
+
+            ar >> t;
+            int const sequencer[] = {0, (ar >> ts, 0)...};
+            (void) sequencer;
+        }
+
+        /// Asynchronously restore the objects stored in the serialized
+        /// section \a name, the objects have to stay alive until the
+        /// returned future has become ready
+        template <typename T, typename... Ts>
+        hpx::future<void> async_restore_section(
+            std::string const& name, T& t, Ts&... ts) const
+        {
+            return hpx::async(
+                [this, name, &t, &ts...]()
+                {
+                    restore_section(name, t, ts...);
+                });
+        }
+
+        /// Return the elements of the array section \a name without copying
+        /// them
+        template <typename T>
+        util::iterator_range<T const*> get_array(std::string const& name) const
+        {
+            std::size_t count = 0;
+            T const* data = static_cast<T const*>(get_array_section(
+                name, sizeof(T), alignof(T), count));
+            return util::iterator_range<T const*>(data, data + count);
+        }
+
+        /// Copy the elements of the array section \a name into \a v
+        template <typename T, typename Allocator>
+        void restore_array(std::string const& name,
+            std::vector<T, Allocator>& v) const
+        {
+            util::iterator_range<T const*> r = get_array<T>(name);
+            v.assign(r.begin(), r.end());
+        }
+
+    private:
+        detail::checkpoint_section_data get_serialized_section(
+            std::string const& name) const;
+
+        void const* get_array_section(std::string const& name,
+            std::size_t element_size, std::size_t alignment,
+            std::size_t& count) const;
+
+        struct mapping;
+
+        std::unique_ptr<mapping> mapping_;
+        char const* data_;
+        std::size_t size_;
+        std::vector<checkpoint_section_info> sections_;
+    };
+}}
+
+#endif
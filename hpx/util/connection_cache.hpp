@@ -30,6 +30,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -38,8 +39,17 @@
 namespace hpx { namespace util
 {
     ///////////////////////////////////////////////////////////////////////////
-    /// This class implements an LRU cache to hold connections. It includes
-    /// entries checked out from the cache in its cache size.
+    /// Strategies for selecting the connections to evict once the
+    /// connection cache is full.
+    enum connection_cache_policy
+    {
+        connection_cache_lru = 0,   ///< evict least recently used first
+        connection_cache_lfu = 1    ///< evict least frequently used first
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements an LRU (or LFU) cache to hold connections. It
+    /// includes entries checked out from the cache in its cache size.
     // TODO: investigate usage of boost.cache.
     template <typename Connection, typename Key>
     class connection_cache
@@ -55,7 +65,9 @@ namespace hpx { namespace util
             value_type,                 // cached (available) connections
             std::size_t,                // number of existing connections
             std::size_t,                // max number of cached connections
-            typename key_tracker_type::iterator     // reference into LRU list
+            typename key_tracker_type::iterator,    // reference into LRU list
+            std::uint64_t,              // number of uses (for LFU)
+            bool                        // never evict this entry
         > cache_value_type;
         typedef std::map<key_type, cache_value_type> cache_type;
         typedef typename cache_type::size_type size_type;
@@ -63,10 +75,12 @@ namespace hpx { namespace util
         connection_cache(
             size_type max_connections
           , size_type max_connections_per_locality
+          , connection_cache_policy policy = connection_cache_lru
         )
           : max_connections_(max_connections < 2 ? 2 : max_connections)
           , max_connections_per_locality_(
                 max_connections_per_locality < 2 ? 2 : max_connections_per_locality)
+          , policy_(policy)
           , connections_(0)
           , shutting_down_(false)
           , insertions_(0)
@@ -74,6 +88,7 @@ namespace hpx { namespace util
           , hits_(0)
           , misses_(0)
           , reclaims_(0)
+          , reconnects_(0)
         {
             if (max_connections_per_locality_ > max_connections_)
             {
@@ -134,6 +149,48 @@ namespace hpx { namespace util
             return util::get<3>(entry);
         }
 
+        static std::uint64_t&
+        num_uses(cache_value_type& entry)
+        {
+            return util::get<4>(entry);
+        }
+        static std::uint64_t const&
+        num_uses(cache_value_type const& entry)
+        {
+            return util::get<4>(entry);
+        }
+
+        static bool&
+        is_pinned(cache_value_type& entry)
+        {
+            return util::get<5>(entry);
+        }
+        static bool const&
+        is_pinned(cache_value_type const& entry)
+        {
+            return util::get<5>(entry);
+        }
+
+        // Update the usage meta data of the given entry.
+        void touch(cache_value_type& e)
+        {
+            key_tracker_.splice(key_tracker_.end(), key_tracker_,
+                lru_reference(e));
+            ++num_uses(e);
+        }
+
+        // A new connection is about to be created for the given key, count it
+        // as a reconnect if one of its connections was evicted before.
+        void track_reconnect(key_type const& l)
+        {
+            typename std::set<key_type>::iterator it = evicted_.find(l);
+            if (it != evicted_.end())
+            {
+                evicted_.erase(it);
+                ++reconnects_;
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Increase the per-locality and overall connection counts.
         void increment_connection_count(cache_value_type& e)
@@ -189,12 +246,8 @@ namespace hpx { namespace util
             {
                 // Key exists in cache.
 
-                // Update LRU meta data.
-                key_tracker_.splice(
-                    key_tracker_.end()
-                  , key_tracker_
-                  , lru_reference(it->second)
-                );
+                // Update LRU/LFU meta data.
+                touch(it->second);
 
                 // If connections to the locality are available in the cache,
                 // remove the oldest one and return it.
@@ -245,12 +298,8 @@ namespace hpx { namespace util
             {
                 // Key exists in cache.
 
-                // Update LRU meta data.
-                key_tracker_.splice(
-                    key_tracker_.end()
-                  , key_tracker_
-                  , lru_reference(it->second)
-                );
+                // Update LRU/LFU meta data.
+                touch(it->second);
 
                 // If connections to the locality are available in the cache,
                 // remove the oldest one and return it.
@@ -283,7 +332,7 @@ namespace hpx { namespace util
                     // reduced in size next time some connection is handed back
                     // to the cache).
 
-                    if (!free_space() &&
+                    if (!free_space(it) &&
                         num_existing_connections(it->second) != 0 &&
                         !force_insert)
                     {
@@ -299,6 +348,7 @@ namespace hpx { namespace util
 
                     // Increase the per-locality and overall connection counts.
                     increment_connection_count(it->second);
+                    track_reconnect(l);
 
                     // Statistics
                     ++insertions_;
@@ -324,7 +374,7 @@ namespace hpx { namespace util
             // fails we grow the cache size beyond its limit (hoping that it
             // will be reduced in size next time some connection is handed back
             // to the cache).
-            free_space();
+            free_space(cache_.end());
 
             // Update LRU meta data.
             typename key_tracker_type::iterator kt =
@@ -332,7 +382,8 @@ namespace hpx { namespace util
 
             cache_.insert(std::make_pair(
                 l, util::make_tuple(
-                    value_type(), 1, max_connections_per_locality_, kt
+                    value_type(), 1, max_connections_per_locality_, kt,
+                    std::uint64_t(1), false
                 ))
             );
 
@@ -341,6 +392,7 @@ namespace hpx { namespace util
 
             // Increase the overall connection counts.
             ++connections_;
+            track_reconnect(l);
 
             ++insertions_;
             check_invariants();
@@ -387,6 +439,7 @@ namespace hpx { namespace util
 
                     // do the accounting
                     ++evictions_;
+                    evicted_.insert(l);
 
                     // the connection itself will go out of scope on return
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
@@ -405,6 +458,20 @@ namespace hpx { namespace util
 //             }
         }
 
+        /// Exempt the entry for \a l from being evicted to make space for
+        /// connections to other localities.
+        ///
+        /// \note The cache must already be aware of \a l, through a prior
+        ///       call to \a get_or_reserve().
+        void pin(key_type const& l)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+
+            typename cache_type::iterator const it = cache_.find(l);
+            if (it != cache_.end())
+                is_pinned(it->second) = true;
+        }
+
         /// Returns true if the overall connection count is equal to or larger
         /// than the maximum number of overall connections, and false otherwise.
         bool full() const
@@ -439,6 +506,7 @@ namespace hpx { namespace util
             std::lock_guard<mutex_type> lock(mtx_);
             key_tracker_.clear();
             cache_.clear();
+            evicted_.clear();
             connections_ = 0;
 
             insertions_ = 0;
@@ -446,6 +514,7 @@ namespace hpx { namespace util
             hits_ = 0;
             misses_ = 0;
             reclaims_ = 0;
+            reconnects_ = 0;
 
             // FIXME: This should probably throw instead of asserting, as it
             // can be triggered by caller error.
@@ -473,6 +542,8 @@ namespace hpx { namespace util
                 std::size_t num_existing = num_existing_connections(it->second);
                 connections_ -= num_existing;
                 evictions_ += num_existing;
+                if (num_existing != 0)
+                    evicted_.insert(l);
 
                 // Erase entry if key exists in the cache.
                 cache_.erase(it);
@@ -498,6 +569,7 @@ namespace hpx { namespace util
 
                 // do the accounting
                 ++evictions_;
+                evicted_.insert(l);
 
                 // the connection itself will go out of scope on return
 #if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
@@ -539,6 +611,14 @@ namespace hpx { namespace util
             return util::get_and_reset_value(reclaims_, reset);
         }
 
+        // number of connections created for localities after one of their
+        // connections had been evicted
+        std::int64_t get_cache_reconnects(bool reset)
+        {
+            std::lock_guard<mutex_type> lock(mtx_);
+            return util::get_and_reset_value(reconnects_, reset);
+        }
+
     private:
         /// Verify class invariants
         void check_invariants() const
@@ -583,27 +663,41 @@ namespace hpx { namespace util
         ///
         /// \returns Returns true if an entry was evicted or if the cache is not
         ///          full, and false if nothing could be evicted.
-        bool free_space()
+        ///
+        /// \note    The entry \a keep is not removed from the cache, even if
+        ///          it has no connections (the caller refers to it).
+        bool free_space(typename cache_type::iterator keep)
         {
             // If the cache isn't full, just return true.
             if (connections_ < max_connections_)
                 return true;
 
+            if (policy_ == connection_cache_lfu)
+                return free_space_lfu(keep);
+
             // Find the least recently used key.
             typename key_tracker_type::iterator kt = key_tracker_.begin();
 
             while (connections_ >= max_connections_)
             {
+                // If we've gone through key_tracker_ and haven't found
+                // anything evict-able, then all the entries must be
+                // currently checked out (or pinned).
+                if (key_tracker_.end() == kt)
+                    return false;
+
                 // Find the least recently used keys data.
                 typename cache_type::iterator ct = cache_.find(*kt);
                 HPX_ASSERT(ct != cache_.end());
 
                 // If the entry is empty, ignore it and try the next least
                 // recently used entry.
-                if (cached_connections(ct->second).empty())
+                if (cached_connections(ct->second).empty() ||
+                    is_pinned(ct->second))
                 {
                     // Remove the key if its connection count is zero.
-                    if (0 == num_existing_connections(ct->second)) {
+                    if (0 == num_existing_connections(ct->second) &&
+                        ct != keep) {
                         cache_.erase(ct);
                         key_tracker_.erase(kt);
                         kt = key_tracker_.begin();
@@ -613,34 +707,85 @@ namespace hpx { namespace util
                         // the eviction?
                         ++kt;
                     }
+                    continue;
+                }
 
-                    // If we've gone through key_tracker_ and haven't found
-                    // anything evict-able, then all the entries must be
-                    // currently checked out.
-                    if (key_tracker_.end() == kt)
-                        return false;
+                evict(ct);
+            }
 
-                    continue;
+            return true;
+        }
+
+        /// Evict connections from the least frequently used entries. The use
+        /// counts of all entries are halved on each invocation, this lets
+        /// localities which are not talked to anymore age out of the cache.
+        bool free_space_lfu(typename cache_type::iterator keep)
+        {
+            while (connections_ >= max_connections_)
+            {
+                typename cache_type::iterator victim = cache_.end();
+
+                typename key_tracker_type::iterator kt = key_tracker_.begin();
+                while (kt != key_tracker_.end())
+                {
+                    typename cache_type::iterator ct = cache_.find(*kt);
+                    HPX_ASSERT(ct != cache_.end());
+
+                    // Remove the key if its connection count is zero.
+                    if (0 == num_existing_connections(ct->second) &&
+                        ct != keep)
+                    {
+                        cache_.erase(ct);
+                        kt = key_tracker_.erase(kt);
+                        continue;
+                    }
+
+                    // Entries are visited from least to most recently used,
+                    // this selects the least recently used of all entries
+                    // with the lowest use count.
+                    if (!cached_connections(ct->second).empty() &&
+                        !is_pinned(ct->second) &&
+                        (victim == cache_.end() ||
+                            num_uses(ct->second) < num_uses(victim->second)))
+                    {
+                        victim = ct;
+                    }
+                    ++kt;
                 }
 
-                // Remove the oldest connection.
-                cached_connections(ct->second).pop_front();
+                // All entries are currently checked out (or pinned).
+                if (victim == cache_.end())
+                    return false;
 
-                // Adjust the overall and per-locality connection count.
-                decrement_connection_count(ct->second);
+                evict(victim);
 
-                // Statistics
-                ++evictions_;
+                for (typename cache_type::value_type& e : cache_)
+                    num_uses(e.second) /= 2;
             }
 
             return true;
         }
 
+        // Remove the oldest cached connection of the given entry.
+        void evict(typename cache_type::iterator ct)
+        {
+            cached_connections(ct->second).pop_front();
+
+            // Adjust the overall and per-locality connection count.
+            decrement_connection_count(ct->second);
+
+            // Statistics
+            ++evictions_;
+            evicted_.insert(ct->first);
+        }
+
         mutable mutex_type mtx_;
         size_type const max_connections_;
         size_type const max_connections_per_locality_;
+        connection_cache_policy const policy_;
         key_tracker_type key_tracker_;
         cache_type cache_;
+        std::set<key_type> evicted_;
         size_type connections_;
         bool shutting_down_;
 
@@ -650,6 +795,7 @@ namespace hpx { namespace util
         std::int64_t hits_;
         std::int64_t misses_;
         std::int64_t reclaims_;
+        std::int64_t reconnects_;
     };
 }}
 
@@ -295,8 +295,8 @@ namespace hpx { namespace util { namespace detail
             ar << is_empty;
             if (!is_empty)
             {
-                std::string const name = serializable_vptr->name;
-                ar << name;
+                hpx::serialization::detail::polymorphic_intrusive_factory::
+                    instance().save_name(ar, serializable_vptr->name);
 
                 serializable_vptr->save_object(object, ar, version);
             }
@@ -310,9 +310,7 @@ namespace hpx { namespace util { namespace detail
             ar >> is_empty;
             if (!is_empty)
             {
-                std::string name;
-                ar >> name;
-                serializable_vptr = detail::get_serializable_vtable<vtable>(name);
+                serializable_vptr = detail::get_serializable_vtable<vtable>(ar);
 
                 vptr = serializable_vptr->vptr;
                 object = serializable_vptr->load_object(
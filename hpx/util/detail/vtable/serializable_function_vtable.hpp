@@ -86,6 +86,17 @@ namespace hpx { namespace util { namespace detail
             hpx::serialization::detail::polymorphic_intrusive_factory::instance().
                 create<serializable_vtable const>(name);
     }
+
+    // load the name (or id) of the function saved to the archive
+    template <typename VTable>
+    serializable_function_vtable<VTable> const*
+    get_serializable_vtable(hpx::serialization::input_archive& ar)
+    {
+        using serializable_vtable = serializable_function_vtable<VTable>;
+        return
+            hpx::serialization::detail::polymorphic_intrusive_factory::instance().
+                create<serializable_vtable const>(ar);
+    }
 }}}
 
 #endif
@@ -53,7 +53,8 @@ namespace hpx { namespace util { namespace detail
 #endif
         else if (k < 32 || k & 1) //-V112
         {
-            if (!hpx::threads::get_self_ptr())
+            if (!hpx::threads::get_self_ptr() ||
+                hpx::threads::is_self_stackless())
             {
 #if defined(HPX_WINDOWS)
                 Sleep(0);
@@ -76,7 +77,8 @@ namespace hpx { namespace util { namespace detail
                     thread_name, "possible deadlock detected");
             }
 #endif
-            if (!hpx::threads::get_self_ptr())
+            if (!hpx::threads::get_self_ptr() ||
+                hpx::threads::is_self_stackless())
             {
 #if defined(HPX_WINDOWS)
                 Sleep(1);
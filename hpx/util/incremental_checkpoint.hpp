@@ -0,0 +1,338 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/util/incremental_checkpoint.hpp
+///
+/// This header defines incremental checkpoints. An incremental_checkpoint
+/// keeps track of the content of the previously saved state by hashing it in
+/// fixed-size blocks and produces checkpoints (deltas) holding only the
+/// blocks which have changed since. apply_checkpoint_deltas reconstructs the
+/// full checkpoint from a base checkpoint and the chain of deltas.
+
+#if !defined(HPX_UTIL_INCREMENTAL_CHECKPOINT_HPP)
+#define HPX_UTIL_INCREMENTAL_CHECKPOINT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/checkpoint.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util
+{
+    namespace detail
+    {
+        // Hash a block of a checkpoint, eight bytes at a time. Every change
+        // of a single word is guaranteed to change the hash value.
+        inline std::uint64_t hash_checkpoint_block(
+            char const* data, std::size_t size)
+        {
+            std::uint64_t const prime = 0x100000001b3ull;
+            std::uint64_t h = 0xcbf29ce484222325ull ^ size;
+
+            std::size_t i = 0;
+            for (/**/; i + sizeof(std::uint64_t) <= size;
+                 i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                h = (h ^ word) * prime;
+            }
+            for (/**/; i != size; ++i)
+            {
+                h = (h ^ static_cast<std::uint8_t>(data[i])) * prime;
+            }
+
+            // final avalanche
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // Hash all blocks of the given checkpoint data
+        inline std::vector<std::uint64_t> hash_checkpoint_blocks(
+            char const* data, std::size_t size, std::size_t block_size)
+        {
+            std::vector<std::uint64_t> hashes;
+            hashes.reserve((size + block_size - 1) / block_size);
+            for (std::size_t pos = 0; pos < size; pos += block_size)
+            {
+                hashes.push_back(hash_checkpoint_block(
+                    data + pos, (std::min)(block_size, size - pos)));
+            }
+            return hashes;
+        }
+
+        inline char const* checkpoint_data(checkpoint const& c)
+        {
+            return c.size() != 0 ? &*c.begin() : nullptr;
+        }
+
+        // Identifies the base checkpoint a chain of deltas belongs to
+        inline std::uint64_t checkpoint_digest(
+            std::vector<std::uint64_t> const& hashes)
+        {
+            return hash_checkpoint_block(
+                reinterpret_cast<char const*>(hashes.data()),
+                hashes.size() * sizeof(std::uint64_t));
+        }
+    }
+
+    ///////////////////////////////////
+    /// Incremental Checkpoint
+    ///
+    /// An incremental_checkpoint remembers the hashes of the fixed-size blocks
+    /// of the most recently saved state. Saving a new state produces a
+    /// checkpoint (a delta) containing only the blocks whose content has
+    /// changed. Deltas are ordinary checkpoints, they can be written to and
+    /// read from streams like any other checkpoint.
+    ///
+    /// Deltas are computed on the serialized data, they are small only if
+    /// the serialized layout of the state stays stable, e.g. if the sizes
+    /// of containers don't change between two checkpoints.
+    class incremental_checkpoint
+    {
+    public:
+        ///////////////////////////////////
+        /// \param block_size   The size of the blocks the state is compared
+        ///                     in (bytes).
+        ///
+        /// The first delta created contains the whole state.
+        explicit incremental_checkpoint(std::size_t block_size = 4096)
+          : block_size_(block_size)
+          , sequence_(0)
+        {
+            init();
+        }
+
+        ///////////////////////////////////
+        /// \param base         The checkpoint the deltas are based on.
+        ///
+        /// \param block_size   The size of the blocks the state is compared
+        ///                     in (bytes).
+        explicit incremental_checkpoint(checkpoint const& base,
+                std::size_t block_size = 4096)
+          : block_size_(block_size)
+          , sequence_(0)
+        {
+            init();
+
+            hashes_ = detail::hash_checkpoint_blocks(
+                detail::checkpoint_data(base), base.size(), block_size_);
+            base_digest_ = detail::checkpoint_digest(hashes_);
+        }
+
+        ///////////////////////////////////
+        /// Return a delta holding the blocks of \a c which differ from the
+        /// previously saved state, \a c becomes the new saved state.
+        checkpoint make_delta(checkpoint const& c)
+        {
+            char const* data = detail::checkpoint_data(c);
+            std::size_t const size = c.size();
+
+            std::vector<std::uint64_t> hashes =
+                detail::hash_checkpoint_blocks(data, size, block_size_);
+
+            std::vector<std::uint64_t> changed;
+            for (std::size_t i = 0; i != hashes.size(); ++i)
+            {
+                if (i >= hashes_.size() || hashes[i] != hashes_[i])
+                    changed.push_back(i);
+            }
+
+            std::vector<char> delta;
+            {
+                hpx::serialization::output_archive ar(delta);
+
+                std::uint64_t const block_size = block_size_;
+                std::uint64_t const total_size = size;
+                ar << base_digest_ << ++sequence_ << block_size << total_size;
+                ar << changed;
+
+                for (std::uint64_t block : changed)
+                {
+                    std::size_t pos = std::size_t(block) * block_size_;
+                    ar << hpx::serialization::make_array(data + pos,
+                        (std::min)(block_size_, size - pos));
+                }
+            }
+
+            hashes_ = std::move(hashes);
+
+            return checkpoint(std::move(delta));
+        }
+
+        ///////////////////////////////////
+        /// Save the given objects and return the delta to the previously
+        /// saved state. This object has to stay alive until the returned
+        /// future has become ready, saves must not overlap.
+        template <typename T, typename... Ts>
+        hpx::future<checkpoint> save(T&& t, Ts&&... ts)
+        {
+            return save_checkpoint(std::forward<T>(t),
+                std::forward<Ts>(ts)...).then(
+                    [this](hpx::future<checkpoint>&& f)
+                    {
+                        return make_delta(f.get());
+                    });
+        }
+
+        template <typename T, typename... Ts>
+        checkpoint save(hpx::launch::sync_policy sync_p, T&& t, Ts&&... ts)
+        {
+            return make_delta(save_checkpoint(sync_p, std::forward<T>(t),
+                std::forward<Ts>(ts)...));
+        }
+
+        /// The number of deltas created so far
+        std::size_t sequence() const
+        {
+            return static_cast<std::size_t>(sequence_);
+        }
+
+        std::size_t block_size() const
+        {
+            return block_size_;
+        }
+
+    private:
+        void init()
+        {
+            if (block_size_ == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "incremental_checkpoint::incremental_checkpoint",
+                    "the block size of an incremental checkpoint must not "
+                    "be zero");
+            }
+            base_digest_ = detail::checkpoint_digest(hashes_);
+        }
+
+        std::size_t block_size_;
+        std::uint64_t base_digest_;
+        std::uint64_t sequence_;
+        std::vector<std::uint64_t> hashes_;
+    };
+
+    ///////////////////////////////////
+    /// Apply_checkpoint_deltas
+    ///
+    /// \param base         The checkpoint the deltas are based on (an empty
+    ///                     checkpoint if the incremental_checkpoint was
+    ///                     created without a base).
+    ///
+    /// \param deltas       All deltas created by the incremental_checkpoint,
+    ///                     in the order they were created.
+    ///
+    /// \returns Apply_checkpoint_deltas returns the checkpoint of the state
+    ///          saved last, it can be passed to restore_checkpoint. Throws
+    ///          if the deltas don't belong to \a base or if the chain of
+    ///          deltas is incomplete.
+    inline checkpoint apply_checkpoint_deltas(
+        checkpoint const& base, std::vector<checkpoint> const& deltas)
+    {
+        std::vector<char> data(base.data);
+        if (deltas.empty())
+            return checkpoint(std::move(data));
+
+        std::uint64_t expected_sequence = 1;
+        bool verified_base = false;
+        for (checkpoint const& c : deltas)
+        {
+            // the delta is read in place
+            hpx::serialization::input_archive ar(c.data, c.size());
+
+            std::uint64_t base_digest = 0, sequence = 0, block_size = 0,
+                size = 0;
+            ar >> base_digest >> sequence >> block_size >> size;
+
+            if (block_size == 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "apply_checkpoint_deltas",
+                    "checkpoint delta data is corrupted");
+            }
+
+            if (!verified_base)
+            {
+                // all deltas refer to the same base, check it only once
+                if (detail::checkpoint_digest(detail::hash_checkpoint_blocks(
+                        data.data(), data.size(), std::size_t(block_size))) !=
+                    base_digest)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "apply_checkpoint_deltas",
+                        "the checkpoint deltas do not belong to the given "
+                        "base checkpoint");
+                }
+                verified_base = true;
+            }
+
+            if (sequence != expected_sequence++)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "apply_checkpoint_deltas",
+                    "the chain of checkpoint deltas is incomplete or out of "
+                    "order");
+            }
+
+            // the data added to the state has to be carried by the delta
+            if (size > data.size() && size - data.size() > c.size())
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "apply_checkpoint_deltas",
+                    "checkpoint delta data is corrupted");
+            }
+
+            std::vector<std::uint64_t> changed;
+            ar >> changed;
+
+            std::uint64_t const num_blocks =
+                size / block_size + (size % block_size != 0 ? 1 : 0);
+
+            data.resize(std::size_t(size));
+            for (std::uint64_t block : changed)
+            {
+                if (block >= num_blocks)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "apply_checkpoint_deltas",
+                        "checkpoint delta data is corrupted");
+                }
+                std::size_t pos = std::size_t(block * block_size);
+                ar >> hpx::serialization::make_array(data.data() + pos,
+                    (std::min)(std::size_t(block_size), data.size() - pos));
+            }
+        }
+        return checkpoint(std::move(data));
+    }
+
+    ///////////////////////////////////
+    /// Restore_incremental_checkpoint
+    ///
+    /// Restores the objects \a t, \a ts... from the state described by the
+    /// base checkpoint \a base and the chain of \a deltas, see
+    /// apply_checkpoint_deltas and restore_checkpoint.
+    template <typename T, typename... Ts>
+    void restore_incremental_checkpoint(checkpoint const& base,
+        std::vector<checkpoint> const& deltas, T& t, Ts&... ts)
+    {
+        restore_checkpoint(apply_checkpoint_deltas(base, deltas), t, ts...);
+    }
+}}
+
+#endif
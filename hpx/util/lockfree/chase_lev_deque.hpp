@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Algorithms from "Dynamic Circular Work-Stealing Deque"
+//  by D. Chase and Y. Lev
+//  Link: http://dl.acm.org/citation.cfm?id=1073974
+//
+//  Memory orderings as proposed in "Correct and Efficient Work-Stealing for
+//  Weak Memory Models" by N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli
+//  Link: http://dl.acm.org/citation.cfm?id=2442524
+//
+//  C++ implementation - Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Disclaimer: Not a Boost library.
+//
+//  The deque has a single owner which is the only one allowed to call
+//  push_bottom() and pop_bottom(). Both are wait-free in the common case (a
+//  plain store plus a fence), only popping the last remaining element requires
+//  a CAS. Any number of thieves may concurrently call steal() which removes
+//  elements from the opposite end using a CAS.
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_JAN_12_2019_0414PM)
+#define HPX_UTIL_LOCKFREE_CHASE_LEV_DEQUE_JAN_12_2019_0414PM
+
+#include <hpx/config.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace lockfree
+{
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque<T> requires T to be trivially copyable");
+
+        // circular array holding the elements, the array is never shrunk
+        struct array
+        {
+            explicit array(std::size_t log_size)
+              : log_size_(log_size)
+              , mask_((std::int64_t(1) << log_size) - 1)
+              , data_(new std::atomic<T>[std::size_t(1) << log_size])
+            {}
+
+            std::int64_t size() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const
+            {
+                return data_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T val)
+            {
+                data_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                array* a = new array(log_size_ + 1);
+                for (std::int64_t i = top; i != bottom; ++i)
+                    a->put(i, get(i));
+                return a;
+            }
+
+            std::size_t log_size_;
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> data_;
+        };
+
+        static std::size_t log2_ceil(std::size_t initial_size)
+        {
+            std::size_t log_size = 4;       // minimal size is 16 elements
+            while ((std::size_t(1) << log_size) < initial_size)
+                ++log_size;
+            return log_size;
+        }
+
+    public:
+        explicit chase_lev_deque(std::size_t initial_size = 128)
+          : array_(new array(log2_ceil(initial_size)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+            retired_.emplace_back(array_.load(std::memory_order_relaxed));
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        // Push an element onto the bottom of the deque (owner only).
+        void push_bottom(T val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->size() - 1)
+            {
+                // the old array is kept alive as concurrent thieves might
+                // still read from it
+                a = a->grow(b, t);
+                retired_.emplace_back(a);
+                array_.store(a, std::memory_order_release);
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Pop an element from the bottom of the deque (owner only).
+        bool pop_bottom(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last element, race against thieves
+                bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        // Remove an element from the top of the deque (any thread).
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            array* a = array_.load(std::memory_order_acquire);
+            val = a->get(t);
+            return top_.data_.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        bool empty() const
+        {
+            return bottom_.data_.load(std::memory_order_relaxed) <=
+                top_.data_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // top_ and bottom_ are written by different threads, keep them on
+        // separate cache lines
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> top_;
+        hpx::util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<array*> array_;
+
+        // all arrays ever used by this deque (accessed by the owner only)
+        std::vector<std::unique_ptr<array>> retired_;
+    };
+}}
+
+#endif
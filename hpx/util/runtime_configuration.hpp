@@ -11,6 +11,7 @@
 #include <hpx/runtime/agas_fwd.hpp>
 #include <hpx/runtime/components/static_factory_data.hpp>
 #include <hpx/runtime/runtime_mode.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/thread_enums.hpp>
 #include <hpx/util/ini.hpp>
 #include <hpx/util/plugin/dll.hpp>
@@ -145,6 +146,10 @@ namespace hpx { namespace util
 
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         bool init_use_stack_guard_pages() const;
+        bool init_use_huge_pages() const;
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+        void init_stack_pool() const;
 #endif
 
         void pre_initialize_ini();
@@ -1069,6 +1069,19 @@ namespace hpx { namespace traits
             >...
         >
     {};
+
+    template <typename T0, typename ...Ts>
+    struct is_bitwise_serializable<
+        ::hpx::util::tuple<T0, Ts...>
+    > : ::hpx::util::detail::all_of<
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<T0>::type
+            >,
+            hpx::traits::is_bitwise_serializable<
+                typename std::remove_const<Ts>::type
+            >...
+        >
+    {};
 }}
 
 namespace hpx { namespace serialization
@@ -63,6 +63,12 @@ namespace hpx { namespace plugins { namespace compression
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    std::size_t snappy_serialization_filter::get_max_flush_length(
+        std::size_t size) const
+    {
+        return snappy::MaxCompressedLength(size);
+    }
+
     bool snappy_serialization_filter::flush(void* dst, std::size_t dst_count,
         std::size_t& written)
     {
@@ -24,6 +24,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -42,6 +43,8 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      max_latency = 1000
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -50,7 +53,9 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "max_latency = 1000";
         }
     };
 }}
@@ -86,6 +91,20 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_max_latency(std::size_t max_latency)
+        {
+            return boost::lexical_cast<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.max_latency",
+                max_latency));
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -101,6 +120,52 @@ namespace hpx { namespace plugins { namespace parcel
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+    }
+
+    void coalescing_message_handler::update_max_latency()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        max_latency_ = detail::get_max_latency(max_latency_);
+    }
+
+    // Derive the number of parcels to coalesce and the flush interval from
+    // the observed time between parcels. The batch size is the number of
+    // parcels expected to arrive within the latency ceiling, the interval is
+    // twice the time needed to fill such a batch (to absorb jitter), but
+    // never longer than the latency ceiling. A batch size of one means that
+    // coalescing would only add latency, the parcels are sent directly.
+    void coalescing_message_handler::update_adaptive_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // long idle periods are clamped to the latency ceiling, this allows
+        // the average to recover quickly once a burst of parcels starts
+        double max_latency_ns = double(max_latency_) * 1000.;
+        double sample = (std::min)(double(time_since_last_parcel), max_latency_ns);
+
+        // exponentially weighted moving average of the time between parcels
+        if (average_time_between_parcels_ < 0)
+            average_time_between_parcels_ = sample;
+        else
+            average_time_between_parcels_ +=
+                (sample - average_time_between_parcels_) / 8.;
+
+        std::size_t num = num_coalesced_parcels_;
+        if (average_time_between_parcels_ > 0)
+        {
+            num = (std::min)(num, std::size_t(
+                max_latency_ns / average_time_between_parcels_));
+        }
+        adaptive_num_coalesced_parcels_ = (std::max)(num, std::size_t(1));
+
+        adaptive_interval_ = (std::min)(max_latency_,
+            std::size_t(2. * double(adaptive_num_coalesced_parcels_) *
+                average_time_between_parcels_ / 1000.) + 1);
+    }
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
@@ -115,6 +180,11 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        max_latency_(detail::get_max_latency(1000)),
+        average_time_between_parcels_(-1.),
+        adaptive_num_coalesced_parcels_(num_coalesced_parcels_),
+        adaptive_interval_(interval_),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -144,6 +214,12 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.max_latency",
+            util::bind(&coalescing_message_handler::update_max_latency, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -162,13 +238,22 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        std::size_t num_coalesced_parcels = num_coalesced_parcels_;
         std::chrono::microseconds interval(interval_);
+        if (adaptive_)
+        {
+            update_adaptive_parameters(time_since_last_parcel);
+            num_coalesced_parcels = adaptive_num_coalesced_parcels_;
+            interval = std::chrono::microseconds(adaptive_interval_);
+        }
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or the arrival rate is too low for coalescing to pay off).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    num_coalesced_parcels <= 1)
            ))
         {
             ++num_messages_;
@@ -182,6 +267,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        // the adaptive batch size may be smaller than the buffer capacity
+        if (s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_coalesced_parcels)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch(s) {
         case detail::message_buffer::first_message:
             // start deadline timer to flush buffer
@@ -0,0 +1,266 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/util/command_line_handling.hpp>
+
+// parcelport
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/lcos/local/spinlock.hpp>
+
+#include <hpx/plugins/parcelport/shmem/header.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <unistd.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        void add_connection(sender * s, std::shared_ptr<sender_connection> const &ptr)
+        {
+            s->add(ptr);
+        }
+
+        // The shared memory parcelport is used for messages between
+        // localities running on the same host. It can't be used for
+        // bootstrapping, the localities find out about each other through
+        // the endpoints exchanged by the bootstrap parcelport.
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality make_here()
+            {
+                // the token distinguishes this locality from any earlier
+                // process which happened to have the same process id
+                std::random_device rd;
+                std::uint64_t token =
+                    (static_cast<std::uint64_t>(rd()) << 32) ^
+                    util::high_resolution_clock::now();
+
+                return parcelset::locality(locality(
+                    boost::asio::ip::host_name(),
+                    static_cast<std::int32_t>(::getpid()), token));
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", "1048576");
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                util::function_nonser<void(std::size_t, char const*)> const& on_start,
+                util::function_nonser<void(std::size_t, char const*)> const& on_stop)
+              : base_type(ini, make_here(), on_start, on_stop)
+              , stopped_(false)
+              , receiver_(*this, ring_buffer::create(
+                    this->here().get<locality>().pid(),
+                    this->here().get<locality>().token(),
+                    ring_size(ini)))
+            {}
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                return true;
+            }
+
+            /// Stop the handling of connectons.
+            void do_stop()
+            {
+                while(do_background_work(0))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const
+            {
+                return this->here().get<locality>().host();
+            }
+
+            /// Alternative parcelports are used only after bootstrapping has
+            /// finished. The destination has to live on the same host and its
+            /// inbound segment has to be accessible.
+            bool can_connect(parcelset::locality const& l,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport && get_peer(l);
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                std::shared_ptr<ring_buffer> ring = get_peer(l);
+                if (!ring)
+                {
+                    HPX_THROWS_IF(ec, network_error,
+                        "shmem::parcelport::create_connection",
+                        "the shared memory segment of the destination "
+                        "locality is not accessible");
+                    return std::shared_ptr<sender_connection>();
+                }
+                return sender_.create_connection(std::move(ring), l, this);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const & ini) const
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(std::size_t num_thread)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                has_work = sender_.background_work();
+                has_work = receiver_.background_work(num_thread) || has_work;
+                return has_work;
+            }
+
+        private:
+            typedef lcos::local::spinlock mutex_type;
+
+            // Return the mapped inbound segment of the given destination, the
+            // result is cached (including failed attempts to open it).
+            std::shared_ptr<ring_buffer> get_peer(parcelset::locality const& l)
+            {
+                locality const& dest = l.get<locality>();
+                if (dest.host() != this->here().get<locality>().host())
+                    return std::shared_ptr<ring_buffer>();
+
+                std::lock_guard<mutex_type> lk(peers_mtx_);
+
+                auto it = peers_.find(dest);
+                if (it == peers_.end())
+                {
+                    it = peers_.emplace(dest,
+                        ring_buffer::open(dest.pid(), dest.token())).first;
+                }
+                return it->second;
+            }
+
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            mutex_type peers_mtx_;
+            std::map<locality, std::shared_ptr<ring_buffer>> peers_;
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 50
+    //
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "50";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static char const* call()
+        {
+            return
+                "ring_size = ${HPX_HAVE_PARCELPORT_SHMEM_RING_SIZE:1048576}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
+
+#endif
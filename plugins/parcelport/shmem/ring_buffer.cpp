@@ -0,0 +1,306 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugins/parcelport/shmem/ring_buffer.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The segment starts with this header, the ring data follows directly.
+    // The head is written by the producers only, the tail by the consumer
+    // only. Both count the bytes transferred since the segment was created,
+    // they are kept on separate cache lines to avoid false sharing.
+    struct ring_buffer::segment_header
+    {
+        static constexpr std::uint64_t magic_value = 0x6870782e73686d65ULL;
+
+        std::uint64_t magic_;
+        std::uint64_t token_;
+        std::uint64_t capacity_;
+        std::atomic<std::uint32_t> producer_lock_;
+
+        util::cache_line_data<std::atomic<std::uint64_t>> head_;
+        util::cache_line_data<std::atomic<std::uint64_t>> tail_;
+    };
+
+    constexpr std::uint64_t ring_buffer::segment_header::magic_value;
+
+    namespace
+    {
+        std::string errno_message(char const* what)
+        {
+            return std::string(what) + ": " + std::strerror(errno);
+        }
+
+        // the producer lock holds the process id of its owner
+        std::uint32_t producer_id()
+        {
+            return static_cast<std::uint32_t>(::getpid());
+        }
+
+        bool process_alive(std::uint32_t pid)
+        {
+            return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+        }
+
+        // number of failed attempts to acquire the producer lock after which
+        // the liveness of its owner is checked
+        constexpr std::size_t owner_check_interval = 1024;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ring_buffer::ring_buffer(std::string name, void* base,
+            std::size_t mapped_size, bool owner)
+      : name_(std::move(name)), base_(base), mapped_size_(mapped_size),
+        owner_(owner), failed_lock_attempts_(0)
+    {}
+
+    ring_buffer::~ring_buffer()
+    {
+        ::munmap(base_, mapped_size_);
+        if (owner_)
+            ::shm_unlink(name_.c_str());
+    }
+
+    std::size_t ring_buffer::data_offset()
+    {
+        std::size_t const align = threads::get_cache_line_size();
+        return (sizeof(segment_header) + align - 1) / align * align;
+    }
+
+    std::string ring_buffer::segment_name(std::int32_t pid)
+    {
+        return "/hpx.shmem." + std::to_string(pid);
+    }
+
+    std::unique_ptr<ring_buffer> ring_buffer::create(std::int32_t pid,
+        std::uint64_t token, std::size_t capacity)
+    {
+        HPX_ASSERT(capacity != 0);
+
+        std::string name = segment_name(pid);
+
+        // a segment with this name can only be left over from a process
+        // which has terminated without cleaning up
+        ::shm_unlink(name.c_str());
+
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+            S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(network_error, "shmem::ring_buffer::create",
+                errno_message(("shm_open(" + name + ")").c_str()));
+            return std::unique_ptr<ring_buffer>();
+        }
+
+        std::size_t mapped_size = data_offset() + capacity;
+        if (::ftruncate(fd, static_cast<off_t>(mapped_size)) == -1)
+        {
+            std::string msg = errno_message("ftruncate");
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(network_error, "shmem::ring_buffer::create",
+                msg);
+            return std::unique_ptr<ring_buffer>();
+        }
+
+        void* base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(network_error, "shmem::ring_buffer::create",
+                errno_message("mmap"));
+            return std::unique_ptr<ring_buffer>();
+        }
+
+        segment_header* h = new (base) segment_header;
+        h->token_ = token;
+        h->capacity_ = capacity;
+        h->producer_lock_.store(0, std::memory_order_relaxed);
+        h->head_.data_.store(0, std::memory_order_relaxed);
+        h->tail_.data_.store(0, std::memory_order_relaxed);
+
+        // publishing the magic value marks the segment as usable
+        std::atomic_thread_fence(std::memory_order_release);
+        h->magic_ = segment_header::magic_value;
+
+        return std::unique_ptr<ring_buffer>(
+            new ring_buffer(std::move(name), base, mapped_size, true));
+    }
+
+    std::shared_ptr<ring_buffer> ring_buffer::open(std::int32_t pid,
+        std::uint64_t token)
+    {
+        std::string name = segment_name(pid);
+
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+            return std::shared_ptr<ring_buffer>();
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1 ||
+            static_cast<std::size_t>(st.st_size) <= data_offset())
+        {
+            ::close(fd);
+            return std::shared_ptr<ring_buffer>();
+        }
+
+        std::size_t mapped_size = static_cast<std::size_t>(st.st_size);
+        void* base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (base == MAP_FAILED)
+            return std::shared_ptr<ring_buffer>();
+
+        std::shared_ptr<ring_buffer> result(
+            new ring_buffer(std::move(name), base, mapped_size, false));
+
+        segment_header const& h = result->header();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (h.magic_ != segment_header::magic_value || h.token_ != token ||
+            data_offset() + h.capacity_ != mapped_size)
+        {
+            return std::shared_ptr<ring_buffer>();
+        }
+
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ring_buffer::segment_header& ring_buffer::header() const
+    {
+        return *static_cast<segment_header*>(base_);
+    }
+
+    char* ring_buffer::data() const
+    {
+        return static_cast<char*>(base_) + data_offset();
+    }
+
+    std::size_t ring_buffer::capacity() const
+    {
+        return static_cast<std::size_t>(header().capacity_);
+    }
+
+    bool ring_buffer::try_lock_producer()
+    {
+        std::atomic<std::uint32_t>& l = header().producer_lock_;
+        std::uint32_t owner = l.load(std::memory_order_relaxed);
+        if (owner == 0)
+        {
+            return l.compare_exchange_strong(owner, producer_id(),
+                std::memory_order_acquire);
+        }
+
+        // A producer which died while holding the lock would block all
+        // other producers forever. The message it left behind is incomplete
+        // and the consumer can't resynchronize, so the ring is unusable.
+        if (++failed_lock_attempts_ % owner_check_interval == 0 &&
+            owner != producer_id() && !process_alive(owner))
+        {
+            HPX_THROW_EXCEPTION(network_error,
+                "shmem::ring_buffer::try_lock_producer",
+                "process " + std::to_string(owner) + " died while writing "
+                "a message to " + name_ + ", the segment can't be used "
+                "anymore");
+        }
+        return false;
+    }
+
+    void ring_buffer::unlock_producer()
+    {
+        HPX_ASSERT(header().producer_lock_.load() == producer_id());
+        header().producer_lock_.store(0, std::memory_order_release);
+    }
+
+    std::size_t ring_buffer::write(void const* data, std::size_t size)
+    {
+        segment_header& h = header();
+        std::uint64_t const capacity = h.capacity_;
+
+        std::uint64_t head = h.head_.data_.load(std::memory_order_relaxed);
+        std::uint64_t tail = h.tail_.data_.load(std::memory_order_acquire);
+
+        std::size_t count = (std::min)(size,
+            static_cast<std::size_t>(capacity - (head - tail)));
+        if (count == 0)
+            return 0;
+
+        // the data may wrap around the end of the ring
+        std::size_t pos = static_cast<std::size_t>(head % capacity);
+        std::size_t first = (std::min)(count,
+            static_cast<std::size_t>(capacity - pos));
+
+        char const* src = static_cast<char const*>(data);
+        std::memcpy(this->data() + pos, src, first);
+        if (first != count)
+            std::memcpy(this->data(), src + first, count - first);
+
+        h.head_.data_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    std::size_t ring_buffer::read(void* data, std::size_t size)
+    {
+        segment_header& h = header();
+        std::uint64_t const capacity = h.capacity_;
+
+        std::uint64_t tail = h.tail_.data_.load(std::memory_order_relaxed);
+        std::uint64_t head = h.head_.data_.load(std::memory_order_acquire);
+
+        std::size_t count = (std::min)(size,
+            static_cast<std::size_t>(head - tail));
+        if (count == 0)
+            return 0;
+
+        std::size_t pos = static_cast<std::size_t>(tail % capacity);
+        std::size_t first = (std::min)(count,
+            static_cast<std::size_t>(capacity - pos));
+
+        char* dest = static_cast<char*>(data);
+        std::memcpy(dest, this->data() + pos, first);
+        if (first != count)
+            std::memcpy(dest + first, this->data(), count - first);
+
+        h.tail_.data_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    bool ring_buffer::empty() const
+    {
+        segment_header const& h = header();
+        return h.head_.data_.load(std::memory_order_acquire) ==
+            h.tail_.data_.load(std::memory_order_relaxed);
+    }
+}}}}
+
+#endif
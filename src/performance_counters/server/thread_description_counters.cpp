@@ -0,0 +1,87 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/runtime/threads/detail/thread_description_profiler.hpp>
+#include <hpx/util/bind_front.hpp>
+#include <hpx/util/function.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace performance_counters
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Discoverer function for per-thread-description profiling counters
+    bool thread_description_counter_discoverer(counter_info const& info,
+        discover_counter_func const& f, discover_counters_mode mode,
+        error_code& ec)
+    {
+        // compose the counter name templates
+        performance_counters::counter_path_elements p;
+        performance_counters::counter_status status =
+            get_counter_path_elements(info.fullname_, p, ec);
+        if (!status_is_valid(status)) return false;
+
+        using hpx::threads::detail::thread_description_profiler;
+        bool result = thread_description_profiler::instance().
+            counter_discoverer(info, p, f, mode, ec);
+        if (!result || ec) return false;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Creation function for per-thread-description profiling counters
+    naming::gid_type thread_description_counter_creator(
+        counter_info const& info,
+        hpx::util::function_nonser<
+            std::int64_t(std::string const&, bool)
+        > const& counter_func,
+        error_code& ec)
+    {
+        switch (info.type_) {
+        case counter_raw:
+            {
+                counter_path_elements paths;
+                get_counter_path_elements(info.fullname_, paths, ec);
+                if (ec) return naming::invalid_gid;
+
+                if (paths.parentinstance_is_basename_) {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "thread_description_counter_creator",
+                        "invalid thread description counter name (instance "
+                        "name must not be a valid base counter name)");
+                    return naming::invalid_gid;
+                }
+
+                // if no parameters (thread description) is given this
+                // counter reports the overall value for all threads
+                hpx::util::function_nonser<std::int64_t(bool)> f =
+                    util::bind_front(counter_func, paths.parameters_);
+
+                return detail::create_raw_counter(info, std::move(f), ec);
+            }
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "thread_description_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+}}
+
+#endif
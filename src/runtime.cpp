@@ -1393,7 +1393,14 @@ namespace hpx { namespace threads
     std::ptrdiff_t get_stack_size(threads::thread_stacksize stacksize)
     {
         if (stacksize == threads::thread_stacksize_current)
-            return threads::get_self_stacksize();
+        {
+            // threads created from a stackless thread don't inherit its
+            // (non-existent) stack
+            if (!threads::is_self_stackless())
+                return threads::get_self_stacksize();
+
+            stacksize = threads::thread_stacksize_default;
+        }
 
         return get_runtime().get_config().get_stack_size(stacksize);
     }
@@ -29,6 +29,7 @@
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/parcelset/put_parcel.hpp>
 #include <hpx/runtime/serialization/detail/polymorphic_id_factory.hpp>
+#include <hpx/runtime/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/util/assert.hpp>
@@ -71,6 +72,11 @@ namespace hpx { namespace agas { namespace detail
         hpx::actions::detail::action_registry& action_registry =
             hpx::actions::detail::action_registry::instance();
         action_registry.fill_missing_typenames();
+
+        hpx::serialization::detail::polymorphic_intrusive_factory&
+            intrusive_registry = hpx::serialization::detail::
+                polymorphic_intrusive_factory::instance();
+        intrusive_registry.fill_missing_typenames();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -120,12 +126,16 @@ namespace hpx { namespace agas { namespace detail
             HPX_ASSERT(!action_ids.empty());
             ar << serialization_ids;      // part running on locality 0
             ar << action_ids;
+            ar << intrusive_typenames;
+            ar << intrusive_ids;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
         {
             ar >> serialization_ids;      // part running on worker node
             ar >> action_ids;
+            ar >> intrusive_typenames;
+            ar >> intrusive_ids;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
@@ -167,6 +177,15 @@ namespace hpx { namespace agas { namespace detail
                     action_ids.push_back(id);
                 }
             }
+            {
+                // Send the complete table of the ids of the polymorphic
+                // classes. Ids are not assigned to classes unknown to
+                // locality 0, as the localities which have connected earlier
+                // would not learn about them.
+                hpx::serialization::detail::polymorphic_intrusive_factory::
+                    instance().get_assigned_typenames(
+                        intrusive_typenames, intrusive_ids);
+            }
         }
 
     public:
@@ -216,10 +235,33 @@ namespace hpx { namespace agas { namespace detail
                 // order problems
                 registry.fill_missing_typenames();
             }
+            {
+                hpx::serialization::detail::polymorphic_intrusive_factory&
+                    registry = hpx::serialization::detail::
+                        polymorphic_intrusive_factory::instance();
+
+                HPX_ASSERT(intrusive_typenames.size() == intrusive_ids.size());
+
+                // this registers the ids of classes which are not known yet
+                // as well, they may be registered later on (e.g. by a
+                // dynamically loaded module)
+                for (std::size_t k = 0; k < intrusive_ids.size(); ++k)
+                {
+                    if (registry.try_get_id(intrusive_typenames[k]) ==
+                        hpx::serialization::detail::
+                            polymorphic_intrusive_factory::invalid_id)
+                    {
+                        registry.register_typename(
+                            intrusive_typenames[k], intrusive_ids[k]);
+                    }
+                }
+            }
         }
 
         std::vector<std::uint32_t> serialization_ids;
         std::vector<std::uint32_t> action_ids;
+        std::vector<std::string> intrusive_typenames;
+        std::vector<std::uint32_t> intrusive_ids;
     };
 }}} // namespace hpx::agas::detail
 
@@ -0,0 +1,244 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <boost/algorithm/string.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    namespace
+    {
+        // every this many decisions one of the alternatives is probed
+        constexpr std::uint64_t probe_interval = 32;
+
+        // exponentially weighted moving average (with a weight of 1/8 for
+        // new samples)
+        double update_average(double average, double sample,
+            std::uint64_t samples)
+        {
+            if (samples == 0)
+                return sample;
+            return average + (sample - average) / 8;
+        }
+
+        // the maximal amount of data the known codecs can compress in one
+        // go (LZ4_MAX_INPUT_SIZE for LZ4, snappy stores the size of the
+        // uncompressed data as a 32 bit number)
+        std::size_t max_codec_input_size(std::string const& name)
+        {
+            if (name == "lz4")
+                return 0x7E000000;
+            if (name == "snappy")
+                return 0xFFFFFFFF;
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+    }
+
+    adaptive_compression::adaptive_compression(
+            util::runtime_configuration const& ini, std::string const& type)
+      : enabled_(false)
+      , threshold_(0)
+      , uncompressed_cost_(0.0)
+      , uncompressed_samples_(0)
+      , bandwidth_(0.0)
+      , decisions_(0)
+      , next_probe_(0)
+      , compressed_messages_(0)
+      , compressed_raw_bytes_(0)
+      , compressed_bytes_(0)
+      , compression_time_(0)
+    {
+        std::string key("hpx.parcel.");
+        key += type;
+
+        enabled_ = hpx::util::get_entry_as<int>(
+            ini, key + ".adaptive_compression", "0") != 0;
+        threshold_ = hpx::util::get_entry_as<std::size_t>(
+            ini, key + ".adaptive_compression_threshold", "65536");
+
+        std::string codecs = ini.get_entry(
+            "hpx.parcel.adaptive_compression_codecs", "lz4,snappy,zlib");
+
+        std::vector<std::string> names;
+        boost::split(names, codecs, boost::is_any_of(","));
+        for (std::string& name : names)
+        {
+            boost::trim(name);
+            if (!name.empty())
+            {
+                codecs_.push_back(
+                    codec_data(name, max_codec_input_size(name)));
+            }
+        }
+    }
+
+    int adaptive_compression::select_codec(std::size_t size)
+    {
+        if (!enabled_ || size < threshold_)
+            return -1;
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        ++decisions_;
+
+        // measure the link and the uncompressed encoding first
+        if (bandwidth_ == 0.0 || uncompressed_samples_ == 0)
+            return -1;
+
+        // codecs which are not available or which can't handle that much
+        // data are never used
+        auto usable = [&](codec_data const& c)
+        {
+            return c.available_ && size <= c.max_size_;
+        };
+
+        // try every codec at least once
+        int const num_codecs = static_cast<int>(codecs_.size());
+        for (int i = 0; i != num_codecs; ++i)
+        {
+            if (usable(codecs_[i]) && codecs_[i].samples_ == 0)
+                return i;
+        }
+
+        // the link or the data might have changed, probe the alternatives
+        // now and then
+        if (decisions_ % probe_interval == 0)
+        {
+            int probe = static_cast<int>(next_probe_++ % (codecs_.size() + 1));
+            if (probe != num_codecs && usable(codecs_[probe]))
+                return probe;
+            return -1;
+        }
+
+        double const bytes = static_cast<double>(size);
+
+        int best = -1;
+        double best_time = bytes * (uncompressed_cost_ + 1.0 / bandwidth_);
+
+        for (int i = 0; i != num_codecs; ++i)
+        {
+            codec_data const& c = codecs_[i];
+            if (!usable(c))
+                continue;
+
+            double time = bytes * (c.cost_ + c.ratio_ / bandwidth_);
+            if (time < best_time)
+            {
+                best = i;
+                best_time = time;
+            }
+        }
+        return best;
+    }
+
+    serialization::binary_filter* adaptive_compression::create_filter(
+        int codec)
+    {
+        HPX_ASSERT(codec >= 0 && codec < static_cast<int>(codecs_.size()));
+
+        error_code ec(lightweight);
+        serialization::binary_filter* filter = hpx::create_binary_filter(
+            codecs_[codec].name_.c_str(), true, nullptr, ec);
+
+        if (ec || filter == nullptr)
+        {
+            // the filter plugin is not available, don't try again
+            std::lock_guard<mutex_type> l(mtx_);
+            codecs_[codec].available_ = false;
+            return nullptr;
+        }
+        return filter;
+    }
+
+    void adaptive_compression::add_encoded_data(int codec,
+        std::size_t raw_bytes, std::size_t bytes, std::int64_t time)
+    {
+        if (codec >= 0)
+        {
+            ++compressed_messages_;
+            compressed_raw_bytes_ += raw_bytes;
+            compressed_bytes_ += bytes;
+            compression_time_ += time;
+        }
+
+        if (raw_bytes == 0 || raw_bytes < threshold_)
+            return;
+
+        double const cost =
+            static_cast<double>(time) / static_cast<double>(raw_bytes);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        if (codec < 0)
+        {
+            uncompressed_cost_ = update_average(
+                uncompressed_cost_, cost, uncompressed_samples_);
+            ++uncompressed_samples_;
+        }
+        else
+        {
+            codec_data& c = codecs_[codec];
+            c.cost_ = update_average(c.cost_, cost, c.samples_);
+            c.ratio_ = update_average(c.ratio_,
+                static_cast<double>(bytes) / static_cast<double>(raw_bytes),
+                c.samples_);
+            ++c.samples_;
+        }
+    }
+
+    void adaptive_compression::add_sent_data(std::size_t bytes,
+        std::int64_t time)
+    {
+        // small messages are dominated by the latency of the link
+        if (bytes < threshold_ || time <= 0)
+            return;
+
+        double const sample =
+            static_cast<double>(bytes) / static_cast<double>(time);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        bandwidth_ = bandwidth_ == 0.0 ? sample :
+            update_average(bandwidth_, sample, 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t adaptive_compression::get_compressed_messages(bool reset)
+    {
+        return reset ? compressed_messages_.exchange(0) :
+            compressed_messages_.load();
+    }
+
+    std::int64_t adaptive_compression::get_compressed_raw_bytes(bool reset)
+    {
+        return reset ? compressed_raw_bytes_.exchange(0) :
+            compressed_raw_bytes_.load();
+    }
+
+    std::int64_t adaptive_compression::get_compressed_bytes(bool reset)
+    {
+        return reset ? compressed_bytes_.exchange(0) :
+            compressed_bytes_.load();
+    }
+
+    std::int64_t adaptive_compression::get_compression_time(bool reset)
+    {
+        return reset ? compression_time_.exchange(0) :
+            compression_time_.load();
+    }
+}}}
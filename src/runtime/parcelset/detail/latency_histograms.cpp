@@ -0,0 +1,243 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histograms.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/bind_front.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace detail
+{
+    latency_histograms::histogram_data::histogram_data(
+            std::string const& action, std::uint32_t locality_id,
+            std::int64_t min_boundary, std::int64_t max_boundary,
+            std::int64_t num_buckets, histogram_data* next)
+      : action_(action)
+      , locality_id_(locality_id)
+      , min_boundary_(min_boundary)
+      , max_boundary_(max_boundary)
+      , num_buckets_(num_buckets)
+      , bucket_size_(double(max_boundary - min_boundary) / double(num_buckets))
+      , counts_(new std::atomic<std::int64_t>[std::size_t(num_buckets) + 2])
+      , next_(next)
+    {
+        for (std::size_t i = 0; i != std::size_t(num_buckets_) + 2; ++i)
+            counts_[i].store(0, std::memory_order_relaxed);
+    }
+
+    void latency_histograms::histogram_data::add(std::int64_t time)
+    {
+        std::size_t bucket = 0;
+        if (time >= max_boundary_)
+        {
+            bucket = std::size_t(num_buckets_) + 1;
+        }
+        else if (time >= min_boundary_)
+        {
+            bucket = (std::min)(
+                std::size_t(double(time - min_boundary_) / bucket_size_),
+                std::size_t(num_buckets_) - 1) + 1;
+        }
+        counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void latency_histograms::histogram_data::get(
+        std::vector<std::int64_t>& result, bool reset)
+    {
+        std::size_t const size = std::size_t(num_buckets_) + 2;
+
+        std::vector<std::int64_t> counts(size);
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            counts[i] = reset ?
+                counts_[i].exchange(0, std::memory_order_relaxed) :
+                counts_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        // same as the density of the bins of hpx::util::histogram (including
+        // the underflow and overflow bins) multiplied by 1000
+        for (std::int64_t count : counts)
+            result.push_back(total == 0 ? 0 : (count * 1000) / total);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    latency_histograms::latency_histograms()
+    {
+        for (std::atomic<histogram_data*>& histograms : histograms_)
+            histograms.store(nullptr);
+    }
+
+    void latency_histograms::add_data(latency_stage stage, char const* action,
+        std::uint32_t locality_id, std::int64_t time)
+    {
+        for (histogram_data* data =
+                histograms_[stage].load(std::memory_order_acquire);
+             data != nullptr; data = data->next_)
+        {
+            if (!data->action_.empty() &&
+                (action == nullptr || data->action_ != action))
+            {
+                continue;
+            }
+
+            if (data->locality_id_ != naming::invalid_locality_id &&
+                data->locality_id_ != locality_id)
+            {
+                continue;
+            }
+
+            data->add(time);
+        }
+    }
+
+    util::function_nonser<std::vector<std::int64_t>(bool)>
+    latency_histograms::get_histogram_counter(latency_stage stage,
+        std::string const& action, std::uint32_t locality_id,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // reuse an existing histogram with the same parameters
+        histogram_data* head =
+            histograms_[stage].load(std::memory_order_relaxed);
+        for (histogram_data* data = head; data != nullptr; data = data->next_)
+        {
+            if (data->action_ == action && data->locality_id_ == locality_id &&
+                data->min_boundary_ == min_boundary &&
+                data->max_boundary_ == max_boundary &&
+                data->num_buckets_ == num_buckets)
+            {
+                return util::bind_front(&latency_histograms::get_histogram,
+                    this, data);
+            }
+        }
+
+        // publish the new histogram only once it is fully constructed
+        storage_.emplace_back(new histogram_data(action, locality_id,
+            min_boundary, max_boundary, num_buckets, head));
+        histogram_data* result = storage_.back().get();
+        histograms_[stage].store(result, std::memory_order_release);
+
+        return util::bind_front(&latency_histograms::get_histogram, this,
+            result);
+    }
+
+    std::vector<std::int64_t> latency_histograms::get_histogram(
+        histogram_data* data, bool reset)
+    {
+        std::vector<std::int64_t> result;
+        result.reserve(std::size_t(data->num_buckets_) + 5);
+
+        // first add histogram parameters
+        result.push_back(data->min_boundary_);
+        result.push_back(data->max_boundary_);
+        result.push_back(data->num_buckets_);
+
+        data->get(result, reset);
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    naming::gid_type latency_histogram_counter_creator(
+        performance_counters::counter_info const& info,
+        latency_histograms& histograms, latency_stage stage, error_code& ec)
+    {
+        switch (info.type_) {
+        case performance_counters::counter_histogram:
+            {
+                performance_counters::counter_path_elements paths;
+                performance_counters::get_counter_path_elements(
+                    info.fullname_, paths, ec);
+                if (ec) return naming::invalid_gid;
+
+                if (paths.parentinstance_is_basename_) {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "latency_histogram_counter_creator",
+                        "invalid counter name for latency histogram "
+                        "(instance name must not be a valid base counter "
+                        "name)");
+                    return naming::invalid_gid;
+                }
+
+                if (paths.instancename_ != "total" ||
+                    paths.instanceindex_ != -1)
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "latency_histogram_counter_creator",
+                        "invalid counter instance name: " +
+                            paths.instancename_);
+                    return naming::invalid_gid;
+                }
+
+                // split parameters, extract separate values
+                std::vector<std::string> params;
+                boost::algorithm::split(params, paths.parameters_,
+                    boost::algorithm::is_any_of(","),
+                    boost::algorithm::token_compress_off);
+
+                std::string action;
+                std::int64_t min_boundary = 0;
+                std::int64_t max_boundary = 1000000;  // 1ms
+                std::int64_t num_buckets = 20;
+                std::uint32_t locality_id = naming::invalid_locality_id;
+
+                if (!params.empty())
+                    action = params[0];
+                if (params.size() > 1 && !params[1].empty())
+                    min_boundary = util::safe_lexical_cast<std::int64_t>(params[1]);
+                if (params.size() > 2 && !params[2].empty())
+                    max_boundary = util::safe_lexical_cast<std::int64_t>(params[2]);
+                if (params.size() > 3 && !params[3].empty())
+                    num_buckets = util::safe_lexical_cast<std::int64_t>(params[3]);
+                if (params.size() > 4 && !params[4].empty())
+                    locality_id = util::safe_lexical_cast<std::uint32_t>(params[4]);
+
+                if (min_boundary >= max_boundary || num_buckets <= 0)
+                {
+                    HPX_THROWS_IF(ec, bad_parameter,
+                        "latency_histogram_counter_creator",
+                        "invalid counter parameter for latency histogram: "
+                        "the boundaries must form a non-empty range and the "
+                        "number of buckets must be positive");
+                    return naming::invalid_gid;
+                }
+
+                return performance_counters::detail::create_raw_counter(info,
+                    histograms.get_histogram_counter(stage, action,
+                        locality_id, min_boundary, max_boundary, num_buckets),
+                    ec);
+            }
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, bad_parameter,
+                "latency_histogram_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+}}}
@@ -159,7 +159,9 @@ namespace hpx { namespace parcelset
     }
 #endif
 
-    parcel::parcel() {}
+    parcel::parcel()
+      : enqueue_time_(0)
+    {}
 
     parcel::~parcel() {}
 
@@ -168,6 +170,7 @@ namespace hpx { namespace parcelset
       : data_(std::move(dest), std::move(addr), act->has_continuation())
       , action_(std::move(act))
       , size_(0)
+      , enqueue_time_(0)
     {
 //         HPX_ASSERT(is_valid());
     }
@@ -177,7 +180,8 @@ namespace hpx { namespace parcelset
         action_(std::move(other.action_)),
         split_gids_(std::move(other.split_gids_)),
         size_(other.size_),
-        num_chunks_(other.num_chunks_)
+        num_chunks_(other.num_chunks_),
+        enqueue_time_(other.enqueue_time_)
     {
         HPX_ASSERT(is_valid());
     }
@@ -189,6 +193,7 @@ namespace hpx { namespace parcelset
         split_gids_ = std::move(other.split_gids_);
         size_ = other.size_;
         num_chunks_ = other.num_chunks_;
+        enqueue_time_ = other.enqueue_time_;
 
         other.reset();
 
@@ -341,6 +346,16 @@ namespace hpx { namespace parcelset
         return size_;
     }
 
+    std::int64_t parcel::enqueue_time() const
+    {
+        return enqueue_time_;
+    }
+
+    void parcel::set_enqueue_time(std::int64_t time)
+    {
+        enqueue_time_ = time;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // generate unique parcel id
     naming::gid_type parcel::generate_unique_id(
@@ -20,6 +20,7 @@
 #include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/message_handler_fwd.hpp>
 #include <hpx/runtime/naming/resolver_client.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histograms.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
 #include <hpx/runtime/parcelset/policies/message_handler.hpp>
 #include <hpx/runtime/parcelset/static_parcelports.hpp>
@@ -50,6 +51,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -409,6 +411,87 @@ namespace hpx { namespace parcelset
         return result;
     }
 
+    void parcelhandler::prewarm_connections()
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        HPX_ASSERT(resolver_);
+        HPX_ASSERT(threads::get_self_ptr());
+
+        std::string targets =
+            get_config_entry("hpx.parcel.prewarm_connections", "0");
+        boost::trim(targets);
+        if (targets.empty() || targets == "0")
+            return;
+
+        // either connect to all localities or to the listed locality ids
+        std::vector<naming::gid_type> localities;
+        if (targets == "1" || targets == "all")
+        {
+            error_code ec(lightweight);
+            if (!resolver_->get_localities(localities, ec) || ec)
+                return;
+        }
+        else
+        {
+            std::vector<std::string> ids;
+            boost::split(ids, targets, boost::is_any_of(","));
+            for (std::string& id : ids)
+            {
+                boost::trim(id);
+                if (id.empty())
+                    continue;
+
+                localities.push_back(naming::get_gid_from_locality_id(
+                    util::safe_lexical_cast<std::uint32_t>(id)));
+            }
+        }
+
+        naming::gid_type const& here = resolver_->get_local_locality();
+
+        lcos::local::counting_semaphore sem;
+        std::int64_t count = 0;
+        for (naming::gid_type const& gid : localities)
+        {
+            if (gid == here)
+                continue;
+
+            threads::register_thread_nullary(
+                [this, gid, &sem]()
+                {
+                    try {
+                        std::pair<std::shared_ptr<parcelport>, locality> dest =
+                            find_appropriate_destination(gid);
+
+                        error_code ec(lightweight);
+                        if (!dest.first->prewarm_connection(dest.second, ec))
+                        {
+                            LPT_(warning)
+                                << "parcelhandler::prewarm_connections: "
+                                   "could not connect to locality " << gid
+                                << ": " << ec.get_message();
+                        }
+                    }
+                    catch (hpx::exception const& e) {
+                        LPT_(warning)
+                            << "parcelhandler::prewarm_connections: "
+                            << e.what();
+                    }
+                    sem.signal();
+                },
+                "parcelhandler::prewarm_connections", threads::pending, true,
+                threads::thread_priority_normal,
+                threads::thread_schedule_hint(),
+                threads::thread_stacksize_medium);
+            ++count;
+        }
+
+        sem.wait(count);
+#endif
+    }
+
     namespace detail
     {
         void parcel_sent_handler(parcelhandler::write_handler_type & f, //-V669
@@ -988,6 +1071,97 @@ namespace hpx { namespace parcelset
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // pending parcel queue statistics
+    std::int64_t parcelhandler::get_pending_parcels_contention(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_parcels_contention(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_pending_parcels_destinations(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_parcels_destinations(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_pending_parcels_max_depth(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_parcels_max_depth(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_pending_parcels_shards(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_pending_parcels_shards(reset) : 0;
+    }
+
+    // receive buffer pool statistics
+    std::int64_t parcelhandler::get_receive_buffer_allocations(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_buffer_allocations(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_receive_buffer_reuses(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_buffer_reuses(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_send_buffer_reallocated_bytes(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_send_buffer_reallocated_bytes(reset) : 0;
+    }
+
+    // adaptive compression statistics
+    std::int64_t parcelhandler::get_compressed_messages(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compressed_messages(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_compressed_raw_bytes(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compressed_raw_bytes(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_compressed_bytes(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compressed_bytes(reset) : 0;
+    }
+
+    std::int64_t parcelhandler::get_compression_time(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_time(reset) : 0;
+    }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
     // number of parcels sent
@@ -1055,6 +1229,10 @@ namespace hpx { namespace parcelset
         {
             register_counter_types(pp.second->type());
             register_connection_cache_counter_types(pp.second->type());
+            register_pending_parcels_counter_types(pp.second->type());
+            register_buffer_counter_types(pp.second->type());
+            register_adaptive_compression_counter_types(pp.second->type());
+            register_latency_histogram_counter_types(pp.second->type());
         }
 
         using util::placeholders::_1;
@@ -1453,6 +1631,9 @@ namespace hpx { namespace parcelset
         util::function_nonser<std::int64_t(bool)> cache_reclaims(
             util::bind_front(&parcelhandler::get_connection_cache_statistics,
                 this, pp_type, parcelport::connection_cache_reclaims));
+        util::function_nonser<std::int64_t(bool)> cache_reconnects(
+            util::bind_front(&parcelhandler::get_connection_cache_statistics,
+                this, pp_type, parcelport::connection_cache_reconnects));
 
         performance_counters::generic_counter_type_data const
             connection_cache_types[] =
@@ -1521,6 +1702,20 @@ namespace hpx { namespace parcelset
                   _1, std::move(cache_reclaims), _2),
               &performance_counters::locality_counter_discoverer,
               ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/cache-reconnects", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of connections created for the {} "
+                  "connection type to localities one of whose connections "
+                  "had been evicted from the connection cache before on the "
+                  "referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(cache_reconnects), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
             }
         };
         performance_counters::install_counter_types(connection_cache_types,
@@ -1528,6 +1723,334 @@ namespace hpx { namespace parcelset
 #endif
     }
 
+    // register performance counters related to the queues of parcels waiting
+    // to be sent
+    void parcelhandler::register_pending_parcels_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> contention(
+            util::bind_front(&parcelhandler::get_pending_parcels_contention,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> destinations(
+            util::bind_front(&parcelhandler::get_pending_parcels_destinations,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> max_depth(
+            util::bind_front(&parcelhandler::get_pending_parcels_max_depth,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> shards(
+            util::bind_front(&parcelhandler::get_pending_parcels_shards,
+                this, pp_type));
+
+        performance_counters::generic_counter_type_data const
+            pending_parcels_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/pending-contention", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of times a thread had to wait for "
+                  "another thread while enqueueing a parcel to be sent using "
+                  "the {} connection type on the referenced locality",
+                      pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(contention), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/pending-destinations", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of destinations which currently have "
+                  "parcels waiting to be sent using the {} connection type "
+                  "on the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(destinations), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/pending-max-depth", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the largest number of parcels currently waiting to "
+                  "be sent to a single destination using the {} connection "
+                  "type on the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(max_depth), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/pending-shards", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of shards of the queues of parcels "
+                  "waiting to be sent using the {} connection type on the "
+                  "referenced locality which currently have pending parcels",
+                      pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(shards), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            }
+        };
+        performance_counters::install_counter_types(pending_parcels_types,
+            sizeof(pending_parcels_types)/sizeof(pending_parcels_types[0]));
+#endif
+    }
+
+    // register performance counters related to the pool of buffers used to
+    // receive zero-copy chunks and to the buffers used to encode messages
+    void parcelhandler::register_buffer_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> allocations(
+            util::bind_front(&parcelhandler::get_receive_buffer_allocations,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> reuses(
+            util::bind_front(&parcelhandler::get_receive_buffer_reuses,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> reallocated_bytes(
+            util::bind_front(&parcelhandler::get_send_buffer_reallocated_bytes,
+                this, pp_type));
+
+        performance_counters::generic_counter_type_data const
+            buffer_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/receive-buffer-allocations", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of buffers newly allocated to receive "
+                  "zero-copy chunks using the {} connection type on the "
+                  "referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(allocations), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/receive-buffer-reuses", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of buffers reused from the pool to "
+                  "receive zero-copy chunks using the {} connection type on "
+                  "the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(reuses), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/send-buffer-reallocated-bytes",
+                  pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of bytes copied because a buffer had "
+                  "to be grown while encoding a message using the {} "
+                  "connection type on the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(reallocated_bytes), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            }
+        };
+        performance_counters::install_counter_types(buffer_types,
+            sizeof(buffer_types)/sizeof(buffer_types[0]));
+#endif
+    }
+
+    // register performance counters related to the adaptive compression of
+    // outgoing messages
+    void parcelhandler::register_adaptive_compression_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        util::function_nonser<std::int64_t(bool)> messages(
+            util::bind_front(&parcelhandler::get_compressed_messages,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> raw_bytes(
+            util::bind_front(&parcelhandler::get_compressed_raw_bytes,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> bytes(
+            util::bind_front(&parcelhandler::get_compressed_bytes,
+                this, pp_type));
+        util::function_nonser<std::int64_t(bool)> time(
+            util::bind_front(&parcelhandler::get_compression_time,
+                this, pp_type));
+
+        performance_counters::generic_counter_type_data const
+            compression_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/count/{}/compressed-messages", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of messages which were compressed "
+                  "because the {} connection type on the referenced locality "
+                  "decided to do so", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(messages), _2),
+              &performance_counters::locality_counter_discoverer,
+              ""
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/compressed-raw-bytes", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of bytes of messages which were "
+                  "compressed by the {} connection type on the referenced "
+                  "locality, measured before compression", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(raw_bytes), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { hpx::util::format(
+                  "/parcelport/count/{}/compressed-bytes", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the number of bytes of messages which were "
+                  "compressed by the {} connection type on the referenced "
+                  "locality, measured after compression", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(bytes), _2),
+              &performance_counters::locality_counter_discoverer,
+              "bytes"
+            },
+            { hpx::util::format(
+                  "/parcelport/time/{}/compression", pp_type),
+              performance_counters::counter_raw,
+              hpx::util::format(
+                  "returns the total time spent serializing and compressing "
+                  "messages which were compressed by the {} connection type "
+                  "on the referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&performance_counters::locality_raw_counter_creator,
+                  _1, std::move(time), _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns"
+            }
+        };
+        performance_counters::install_counter_types(compression_types,
+            sizeof(compression_types)/sizeof(compression_types[0]));
+#endif
+    }
+
+    // register the histograms of the latencies of the parcel layer
+    void parcelhandler::register_latency_histogram_counter_types(
+        std::string const& pp_type)
+    {
+#if defined(HPX_HAVE_NETWORKING)
+        if (!is_networking_enabled_)
+            return;
+
+        error_code ec(lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        if (pp == nullptr)
+            return;
+
+        using hpx::util::placeholders::_1;
+        using hpx::util::placeholders::_2;
+
+        detail::latency_histograms& histograms = pp->get_latency_histograms();
+
+        performance_counters::generic_counter_type_data const
+            histogram_types[] =
+        {
+            { hpx::util::format(
+                  "/parcelport/histogram/{}/enqueue-to-send", pp_type),
+              performance_counters::counter_histogram,
+              hpx::util::format(
+                  "returns the histogram of the times between handing "
+                  "parcels to the {} connection type on the referenced "
+                  "locality and encoding them into a message", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&detail::latency_histogram_counter_creator,
+                  _1, std::ref(histograms), detail::latency_enqueue_to_send,
+                  _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns/0.1%"
+            },
+            { hpx::util::format(
+                  "/parcelport/histogram/{}/serialization", pp_type),
+              performance_counters::counter_histogram,
+              hpx::util::format(
+                  "returns the histogram of the times needed to serialize "
+                  "parcels sent using the {} connection type on the "
+                  "referenced locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&detail::latency_histogram_counter_creator,
+                  _1, std::ref(histograms), detail::latency_serialization,
+                  _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns/0.1%"
+            },
+            { hpx::util::format(
+                  "/parcelport/histogram/{}/wire", pp_type),
+              performance_counters::counter_histogram,
+              hpx::util::format(
+                  "returns the histogram of the times needed to send "
+                  "messages using the {} connection type on the referenced "
+                  "locality", pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&detail::latency_histogram_counter_creator,
+                  _1, std::ref(histograms), detail::latency_wire, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns/0.1%"
+            },
+            { hpx::util::format(
+                  "/parcelport/histogram/{}/receive-to-schedule", pp_type),
+              performance_counters::counter_histogram,
+              hpx::util::format(
+                  "returns the histogram of the times between receiving "
+                  "messages using the {} connection type on the referenced "
+                  "locality and scheduling the threads for their parcels",
+                  pp_type),
+              HPX_PERFORMANCE_COUNTER_V1,
+              util::bind(&detail::latency_histogram_counter_creator,
+                  _1, std::ref(histograms),
+                  detail::latency_receive_to_schedule, _2),
+              &performance_counters::locality_counter_discoverer,
+              "ns/0.1%"
+            }
+        };
+        performance_counters::install_counter_types(histogram_types,
+            sizeof(histogram_types)/sizeof(histogram_types[0]));
+#endif
+    }
+
     std::vector<plugins::parcelport_factory_base *> &
     parcelhandler::get_parcelport_factories()
     {
@@ -1602,7 +2125,22 @@ namespace hpx { namespace parcelset
             "array_optimization = ${HPX_PARCEL_ARRAY_OPTIMIZATION:1}",
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
                 "$[hpx.parcel.array_optimization]}",
+            "zero_copy_serialization_threshold = "
+                "${HPX_PARCEL_ZERO_COPY_SERIALIZATION_THRESHOLD:"
+                HPX_PP_STRINGIZE(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}",
             "async_serialization = ${HPX_PARCEL_ASYNC_SERIALIZATION:1}",
+            "pending_queue_shards = ${HPX_PARCEL_PENDING_QUEUE_SHARDS:64}",
+            "receive_buffer_pool_size = ${HPX_PARCEL_RECEIVE_BUFFER_POOL_SIZE:16}",
+            "receive_buffer_pool_bytes = "
+                "${HPX_PARCEL_RECEIVE_BUFFER_POOL_BYTES:67108864}",
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}",
+            "connection_cache_policy = ${HPX_PARCEL_CONNECTION_CACHE_POLICY:lru}",
+            "prewarm_connections = ${HPX_PARCEL_PREWARM_CONNECTIONS:0}",
+            "adaptive_compression = ${HPX_PARCEL_ADAPTIVE_COMPRESSION:0}",
+            "adaptive_compression_threshold = "
+                "${HPX_PARCEL_ADAPTIVE_COMPRESSION_THRESHOLD:65536}",
+            "adaptive_compression_codecs = "
+                "${HPX_PARCEL_ADAPTIVE_COMPRESSION_CODECS:lz4,snappy,zlib}",
 #if defined(HPX_HAVE_PARCEL_COALESCING)
             "message_handlers = ${HPX_PARCEL_MESSAGE_HANDLERS:1}"
 #else
@@ -8,6 +8,7 @@
 #include <hpx/config.hpp>
 #include <hpx/state.hpp>
 #include <hpx/runtime_fwd.hpp>
+#include <hpx/pp/stringize.hpp>
 #include <hpx/runtime/applier/applier.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/runtime/threads/thread.hpp>
@@ -20,10 +21,13 @@
 #endif
 #include <hpx/util/assert.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -33,13 +37,23 @@ namespace hpx { namespace parcelset
     parcelport::parcelport(util::runtime_configuration const& ini,
             locality const & here, std::string const& type)
       : applier_(nullptr),
-        num_parcel_destinations_(0),
+        pending_parcels_shards_((std::max)(std::size_t(1),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.pending_queue_shards", "64"))),
+        num_active_pending_shards_(0),
+        pending_parcels_contention_(0),
+        send_buffer_reallocated_bytes_(0),
+        adaptive_compression_(ini, type),
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
+        zero_copy_serialization_threshold_(
+            HPX_ZERO_COPY_SERIALIZATION_THRESHOLD),
         async_serialization_(false),
+        use_priority_lanes_(hpx::util::get_entry_as<int>(ini,
+            "hpx.parcel.priority_lanes", "1") != 0),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", "0")),
         type_(type)
@@ -62,6 +76,18 @@ namespace hpx { namespace parcelset
             }
         }
 
+        receive_buffer_pool_ = std::make_shared<util::buffer_pool<char> >(
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.receive_buffer_pool_size", "16"),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                "hpx.parcel.receive_buffer_pool_bytes", "67108864"));
+
+        // a threshold of zero would create empty zero-copy chunks
+        zero_copy_serialization_threshold_ = (std::max)(std::size_t(1),
+            hpx::util::get_entry_as<std::size_t>(ini,
+                key + ".zero_copy_serialization_threshold",
+                HPX_PP_STRINGIZE(HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)));
+
         if (hpx::util::get_entry_as<int>(
                 ini, key + ".async_serialization", "0") != 0)
         {
@@ -69,6 +95,36 @@ namespace hpx { namespace parcelset
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t parcelport::get_max_priority_connections(
+        std::size_t max_connections, bool use_priority_lanes)
+    {
+        if (!use_priority_lanes)
+            return 0;
+
+        // priority parcels are rare, an eighth of the connections is
+        // reserved for them (connection caches hold at least two)
+        return (std::max)(std::size_t(2), max_connections / 8);
+    }
+
+    parcelport::parcel_lane parcelport::get_parcel_lane(parcel const& p) const
+    {
+        if (use_priority_lanes_)
+        {
+            switch (p.get_thread_priority())
+            {
+            case threads::thread_priority_high_recursive:
+            case threads::thread_priority_boost:
+            case threads::thread_priority_high:
+                return parcel_lane_priority;
+
+            default:
+                break;
+            }
+        }
+        return parcel_lane_normal;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Update performance counter data
     void parcelport::add_received_data(
@@ -81,6 +137,18 @@ namespace hpx { namespace parcelset
         performance_counters::parcels::data_point const& data)
     {
         parcels_sent_.add_data(data);
+
+        // the adaptive compression needs to know the throughput of the link
+        if (adaptive_compression_.enabled())
+        {
+            adaptive_compression_.add_sent_data(data.bytes_, data.time_);
+        }
+
+        if (latency_histograms_.enabled(detail::latency_wire))
+        {
+            latency_histograms_.add_data(detail::latency_wire, data.action_,
+                data.locality_id_, data.time_);
+        }
     }
 
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
@@ -186,18 +254,112 @@ namespace hpx { namespace parcelset
 
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<lcos::local::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
+        for (auto& shard : pending_parcels_shards_)
+        {
+            std::lock_guard<lcos::local::spinlock> l(shard.data_.mtx_);
+            for (auto& lane : shard.data_.pending_parcels_)
+            {
+                for (auto && p : lane)
+                {
+                    count += hpx::util::get<0>(p.second).size();
+                    HPX_ASSERT(
+                        hpx::util::get<0>(p.second).size() ==
+                        hpx::util::get<1>(p.second).size());
+                }
+            }
+        }
+        return count;
+    }
+
+    std::int64_t parcelport::get_pending_parcels_contention(bool reset)
+    {
+        if (reset)
+            return pending_parcels_contention_.exchange(0);
+        return pending_parcels_contention_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t parcelport::get_pending_parcels_destinations(bool /*reset*/)
+    {
+        std::int64_t count = 0;
+        for (auto& shard : pending_parcels_shards_)
         {
-            count += hpx::util::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::util::get<0>(p.second).size() ==
-                hpx::util::get<1>(p.second).size());
+            std::lock_guard<lcos::local::spinlock> l(shard.data_.mtx_);
+
+            // count destinations having parcels in both lanes only once
+            pending_parcels_destinations const& normal =
+                shard.data_.parcel_destinations_[parcel_lane_normal];
+            count += normal.size();
+            for (locality const& loc :
+                shard.data_.parcel_destinations_[parcel_lane_priority])
+            {
+                if (normal.find(loc) == normal.end())
+                    ++count;
+            }
         }
         return count;
     }
 
+    std::int64_t parcelport::get_pending_parcels_max_depth(bool /*reset*/)
+    {
+        std::size_t depth = 0;
+        for (auto& shard : pending_parcels_shards_)
+        {
+            std::lock_guard<lcos::local::spinlock> l(shard.data_.mtx_);
+            for (auto& lane : shard.data_.pending_parcels_)
+            {
+                for (auto && p : lane)
+                {
+                    depth = (std::max)(
+                        depth, hpx::util::get<0>(p.second).size());
+                }
+            }
+        }
+        return static_cast<std::int64_t>(depth);
+    }
+
+    std::int64_t parcelport::get_pending_parcels_shards(bool /*reset*/)
+    {
+        return static_cast<std::int64_t>(num_active_pending_shards_.load());
+    }
+
+    std::int64_t parcelport::get_receive_buffer_allocations(bool reset)
+    {
+        return receive_buffer_pool_->get_allocation_count(reset);
+    }
+
+    std::int64_t parcelport::get_receive_buffer_reuses(bool reset)
+    {
+        return receive_buffer_pool_->get_reuse_count(reset);
+    }
+
+    std::int64_t parcelport::get_send_buffer_reallocated_bytes(bool reset)
+    {
+        if (reset)
+            return send_buffer_reallocated_bytes_.exchange(0);
+        return send_buffer_reallocated_bytes_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t parcelport::get_compressed_messages(bool reset)
+    {
+        return adaptive_compression_.get_compressed_messages(reset);
+    }
+
+    std::int64_t parcelport::get_compressed_raw_bytes(bool reset)
+    {
+        return adaptive_compression_.get_compressed_raw_bytes(reset);
+    }
+
+    std::int64_t parcelport::get_compressed_bytes(bool reset)
+    {
+        return adaptive_compression_.get_compressed_bytes(reset);
+    }
+
+    std::int64_t parcelport::get_compression_time(bool reset)
+    {
+        return adaptive_compression_.get_compression_time(reset);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
@@ -158,6 +158,15 @@ namespace hpx { namespace resource { namespace detail
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_chase_lev:
+            sched = "local_chase_lev";
+            break;
+        case resource::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
+        case resource::edf:
+            sched = "edf";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -458,6 +467,19 @@ namespace hpx { namespace resource { namespace detail
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("local-chase-lev").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_chase_lev;
+        }
+        else if (0 == std::string("local-priority-chase-lev").find(
+                     cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
+        else if (0 == std::string("edf").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::edf;
+        }
         else
         {
             throw hpx::detail::command_line_error(
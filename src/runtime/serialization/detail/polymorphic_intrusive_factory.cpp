@@ -9,9 +9,16 @@
 
 #include <hpx/config.hpp>
 #include <hpx/exception.hpp>
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/util/assert.hpp>
 #include <hpx/util/static.hpp>
 
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace hpx { namespace serialization { namespace detail
 {
@@ -35,6 +42,12 @@ namespace hpx { namespace serialization { namespace detail
         if (it == map_.end())
         {
             map_.emplace(name, fun);
+
+            // populate cache
+            typename_to_id_type::const_iterator jt =
+                typename_to_id_.find(name);
+            if (jt != typename_to_id_.end())
+                cache_id(jt->second, fun);
         }
     }
 
@@ -43,4 +56,125 @@ namespace hpx { namespace serialization { namespace detail
     {
         return map_.at(name)();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The id is written first, the name follows only if no id has been
+    // assigned to the class (yet).
+    void polymorphic_intrusive_factory::save_name(
+        output_archive& ar, std::string const& name) const
+    {
+        if (ar.enable_type_ids())
+        {
+            std::uint32_t const id = try_get_id(name);
+            ar << id;
+            if (id != invalid_id)
+                return;
+        }
+        ar << name;
+    }
+
+    void* polymorphic_intrusive_factory::create(input_archive& ar) const
+    {
+        if (ar.enable_type_ids())
+        {
+            std::uint32_t id = invalid_id;
+            ar >> id;
+            if (id != invalid_id)
+            {
+                if (id >= cache_.size() || cache_[id] == nullptr)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error
+                        , "polymorphic_intrusive_factory::create"
+                        , "Unknown type descriptor " + std::to_string(id));
+                    return nullptr;
+                }
+                return cache_[id]();
+            }
+        }
+
+        std::string name;
+        ar >> name;
+        return create(name);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void polymorphic_intrusive_factory::register_typename(
+        std::string const& name, std::uint32_t id)
+    {
+        HPX_ASSERT(id != invalid_id);
+
+        std::pair<typename_to_id_type::iterator, bool> p =
+            typename_to_id_.emplace(name, id);
+
+        if (!p.second)
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "polymorphic_intrusive_factory::register_typename",
+                "failed to insert " + name +
+                " into typename to id registry");
+            return;
+        }
+
+        // populate cache
+        ctor_map_type::const_iterator it = map_.find(name);
+        if (it != map_.end())
+            cache_id(id, it->second);
+
+        if (id > max_id_) max_id_ = id;
+    }
+
+    // Assign ids to all classes which don't have one yet, this is done on
+    // the root locality only.
+    void polymorphic_intrusive_factory::fill_missing_typenames()
+    {
+        for (std::string const& name : get_unassigned_typenames())
+            register_typename(name, ++max_id_);
+    }
+
+    std::uint32_t polymorphic_intrusive_factory::try_get_id(
+        std::string const& name) const
+    {
+        typename_to_id_type::const_iterator it = typename_to_id_.find(name);
+        if (it == typename_to_id_.end())
+            return invalid_id;
+
+        return it->second;
+    }
+
+    std::vector<std::string>
+    polymorphic_intrusive_factory::get_unassigned_typenames() const
+    {
+        std::vector<std::string> result;
+
+        for (auto const& v : map_)
+        {
+            if (!typename_to_id_.count(v.first))
+                result.push_back(v.first);
+        }
+
+        return result;
+    }
+
+    void polymorphic_intrusive_factory::get_assigned_typenames(
+        std::vector<std::string>& names, std::vector<std::uint32_t>& ids) const
+    {
+        names.reserve(typename_to_id_.size());
+        ids.reserve(typename_to_id_.size());
+
+        for (auto const& v : typename_to_id_)
+        {
+            names.push_back(v.first);
+            ids.push_back(v.second);
+        }
+    }
+
+    void polymorphic_intrusive_factory::cache_id(
+        std::uint32_t id, ctor_type fun)
+    {
+        if (id >= cache_.size())
+            cache_.resize(id + 1, nullptr);
+
+        if (cache_[id] == nullptr)
+            cache_[id] = fun;
+    }
 }}}
@@ -0,0 +1,229 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+
+#include <hpx/runtime/resource/detail/partitioner.hpp>
+#include <hpx/runtime/threads/coroutines/detail/posix_utility.hpp>
+#include <hpx/runtime/threads/detail/thread_num_tss.hpp>
+#include <hpx/runtime/threads/topology.hpp>
+#include <hpx/util/cache_aligned_data.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail
+{
+    namespace posix
+    {
+        HPX_EXPORT std::size_t stack_pool_high_watermark = 0;
+        HPX_EXPORT std::size_t stack_pool_low_watermark = 0;
+        HPX_EXPORT bool use_madv_free = false;
+
+        namespace
+        {
+            ///////////////////////////////////////////////////////////////////
+            std::atomic<std::uint64_t> stack_allocation_count(0);
+            std::atomic<std::uint64_t> stack_reuse_count(0);
+            std::atomic<std::uint64_t> stack_trim_count(0);
+
+            ///////////////////////////////////////////////////////////////////
+            // all pooled stacks of one size
+            struct stack_bucket
+            {
+                explicit stack_bucket(std::size_t size)
+                  : size_(size)
+                {}
+
+                std::size_t count() const
+                {
+                    return hot_.size() + cold_.size();
+                }
+
+                std::size_t size_;
+                std::vector<void*> hot_;    // stacks with physical memory
+                std::vector<void*> cold_;   // stacks without physical memory
+            };
+
+            // all pooled stacks of one NUMA domain
+            struct domain_stack_pool
+            {
+                typedef hpx::util::spinlock mutex_type;
+
+                ~domain_stack_pool()
+                {
+                    for (stack_bucket& b : buckets_)
+                    {
+                        for (void* stack : b.hot_)
+                            free_stack(stack, b.size_);
+                        for (void* stack : b.cold_)
+                            free_stack(stack, b.size_);
+                    }
+                }
+
+                // Note: mtx_ must be locked
+                stack_bucket& get_bucket(std::size_t size)
+                {
+                    for (stack_bucket& b : buckets_)
+                    {
+                        if (b.size_ == size)
+                            return b;
+                    }
+                    buckets_.emplace_back(size);
+                    return buckets_.back();
+                }
+
+                mutex_type mtx_;
+                std::vector<stack_bucket> buckets_;
+            };
+
+            typedef std::vector<
+                    hpx::util::cache_aligned_data<domain_stack_pool>
+                > stack_pools_type;
+
+            stack_pools_type& get_stack_pools()
+            {
+                static stack_pools_type pools((std::max)(std::size_t(1),
+                    threads::get_topology().get_number_of_numa_nodes()));
+                return pools;
+            }
+
+            // return the NUMA domain the calling (worker) thread is running on
+            std::size_t get_numa_domain(std::size_t num_domains)
+            {
+                static HPX_NATIVE_TLS std::size_t numa_domain = std::size_t(-1);
+                if (numa_domain == std::size_t(-1))
+                {
+                    std::size_t num_thread = threads::detail::get_thread_num_tss();
+                    if (num_thread == std::size_t(-1))
+                        return 0;       // not a worker thread
+
+                    std::size_t pu_num =
+                        hpx::resource::get_partitioner().get_pu_num(num_thread);
+                    numa_domain =
+                        threads::get_topology().get_numa_node_number(pu_num);
+                }
+                return numa_domain % num_domains;
+            }
+
+            domain_stack_pool& get_domain_stack_pool()
+            {
+                stack_pools_type& pools = get_stack_pools();
+                return pools[get_numa_domain(pools.size())].data_;
+            }
+
+            // release the physical memory of the given stack, the stack stays
+            // mapped
+            void make_stack_cold(void* stack, std::size_t size)
+            {
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) \
+ && _POSIX_MAPPED_FILES > 0
+#if defined(MADV_FREE)
+                if (use_madv_free)
+                {
+                    ::madvise(stack, size, MADV_FREE);
+                    return;
+                }
+#endif
+                ::madvise(stack, size, MADV_DONTNEED);
+#endif
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void* pool_alloc_stack(std::size_t size)
+        {
+            if (use_stack_pool())
+            {
+                domain_stack_pool& pool = get_domain_stack_pool();
+
+                void* stack = nullptr;
+                {
+                    std::lock_guard<domain_stack_pool::mutex_type> l(pool.mtx_);
+
+                    stack_bucket& b = pool.get_bucket(size);
+                    if (!b.hot_.empty())
+                    {
+                        stack = b.hot_.back();
+                        b.hot_.pop_back();
+                    }
+                    else if (!b.cold_.empty())
+                    {
+                        stack = b.cold_.back();
+                        b.cold_.pop_back();
+                    }
+                }
+
+                if (stack != nullptr)
+                {
+                    ++stack_reuse_count;
+                    return stack;
+                }
+            }
+
+            ++stack_allocation_count;
+            return alloc_stack(size);
+        }
+
+        void pool_free_stack(void* stack, std::size_t size)
+        {
+            if (use_stack_pool())
+            {
+                domain_stack_pool& pool = get_domain_stack_pool();
+
+                std::unique_lock<domain_stack_pool::mutex_type> l(pool.mtx_);
+
+                stack_bucket& b = pool.get_bucket(size);
+                if (b.hot_.size() < stack_pool_low_watermark)
+                {
+                    b.hot_.push_back(stack);
+                    return;
+                }
+
+                if (b.count() < stack_pool_high_watermark)
+                {
+                    l.unlock();
+                    make_stack_cold(stack, size);
+                    ++stack_trim_count;
+
+                    l.lock();
+                    pool.get_bucket(size).cold_.push_back(stack);
+                    return;
+                }
+            }
+
+            ++stack_trim_count;
+            free_stack(stack, size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::uint64_t get_stack_allocation_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_allocation_count, reset);
+        }
+
+        std::uint64_t get_stack_reuse_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_reuse_count, reset);
+        }
+
+        std::uint64_t get_stack_trim_count(bool reset)
+        {
+            return util::get_and_reset_value(stack_trim_count, reset);
+        }
+    }
+}}}}
+
+#endif
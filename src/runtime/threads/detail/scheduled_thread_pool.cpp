@@ -13,6 +13,11 @@
 template class HPX_EXPORT hpx::threads::policies::local_queue_scheduler<>;
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_queue_scheduler<>>;
+template class HPX_EXPORT hpx::threads::policies::local_queue_scheduler<
+    hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_queue_scheduler<hpx::compat::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
 #endif
 
 #if defined(HPX_HAVE_STATIC_SCHEDULER)
@@ -40,6 +45,17 @@ template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<hpx::compat::mutex,
         hpx::threads::policies::lockfree_lifo>>;
+template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler<
+    hpx::compat::mutex, hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<hpx::compat::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
+template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler<
+    hpx::compat::mutex, hpx::threads::policies::edf_queue,
+    hpx::threads::policies::edf_queue>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<hpx::compat::mutex,
+        hpx::threads::policies::edf_queue, hpx::threads::policies::edf_queue>>;
 
 #if defined(HPX_HAVE_ABP_SCHEDULER)
 template class HPX_EXPORT hpx::threads::policies::local_priority_queue_scheduler<
@@ -0,0 +1,450 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+#include <hpx/error_code.hpp>
+#include <hpx/exception.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/threads/detail/thread_description_profiler.hpp>
+#include <hpx/runtime/threads/thread_data.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/logging.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
+#include <hpx/util/thread_description.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace threads { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // all data collected by one OS thread
+    struct thread_description_profiler::worker_data
+    {
+        struct entry
+        {
+            explicit entry(util::thread_description const& desc)
+              : desc_(desc)
+            {}
+
+            util::thread_description desc_;
+            statistics stats_;
+        };
+
+        worker_data()
+          : cycles_fd_(-1), cache_misses_fd_(-1)
+        {}
+
+        ~worker_data()
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            if (cache_misses_fd_ != -1)
+                ::close(cache_misses_fd_);
+            if (cycles_fd_ != -1)
+                ::close(cycles_fd_);
+#endif
+        }
+
+        // The hardware counters are opened as one group (with the cycle
+        // counter being the group leader) for the calling thread, which
+        // allows to read both values with a single system call.
+        void open_hardware_counters()
+        {
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            perf_event_attr attr = {};
+            attr.size = sizeof(perf_event_attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+
+            cycles_fd_ = static_cast<int>(
+                ::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+            if (cycles_fd_ == -1)
+            {
+                LTM_(warning) << "thread_description_profiler: "
+                    "could not open hardware counters, hardware counter "
+                    "profiling is disabled for this thread";
+                return;
+            }
+
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            cache_misses_fd_ = static_cast<int>(
+                ::syscall(__NR_perf_event_open, &attr, 0, -1, cycles_fd_, 0));
+
+            ::ioctl(cycles_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ::ioctl(cycles_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+        }
+
+        bool read_hardware_counters(
+            std::uint64_t& cycles, std::uint64_t& cache_misses)
+        {
+            cycles = 0;
+            cache_misses = 0;
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            if (cycles_fd_ == -1)
+                return false;
+
+            // layout as defined by PERF_FORMAT_GROUP: number of values
+            // followed by the values of all counters in the group
+            std::uint64_t values[3] = { 0, 0, 0 };
+            if (::read(cycles_fd_, values, sizeof(values)) <
+                    static_cast<ssize_t>(2 * sizeof(std::uint64_t)))
+            {
+                return false;
+            }
+
+            cycles = values[1];
+            if (values[0] > 1)
+                cache_misses = values[2];
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        thread_description_profiler::mutex_type mtx_;
+
+        // keyed by the address of the description string (or the function
+        // address if no description is available)
+        std::unordered_map<std::size_t, entry> entries_;
+
+        int cycles_fd_;
+        int cache_misses_fd_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    thread_description_profiler::thread_description_profiler()
+      : enabled_(false)
+      , hardware_counters_(false)
+      , print_at_shutdown_(false)
+    {}
+
+    thread_description_profiler::~thread_description_profiler() = default;
+
+    thread_description_profiler& thread_description_profiler::instance()
+    {
+        struct tag {};
+        hpx::util::static_<thread_description_profiler, tag> profiler;
+        return profiler.get();
+    }
+
+    void thread_description_profiler::init()
+    {
+        enabled_ = hpx::get_config_entry(
+            "hpx.thread_profiling.enabled", "0") != "0";
+        hardware_counters_ = enabled_ && hpx::get_config_entry(
+            "hpx.thread_profiling.hardware_counters", "0") != "0";
+        print_at_shutdown_ = enabled_ && hpx::get_config_entry(
+            "hpx.thread_profiling.print_at_shutdown", "1") != "0";
+    }
+
+    thread_description_profiler::worker_data&
+    thread_description_profiler::get_worker_data()
+    {
+        static HPX_NATIVE_TLS worker_data* data = nullptr;
+        if (data == nullptr)
+        {
+            std::unique_ptr<worker_data> d(new worker_data);
+            if (hardware_counters_)
+                d->open_hardware_counters();
+
+            data = d.get();
+
+            std::lock_guard<mutex_type> l(mtx_);
+            workers_.push_back(std::move(d));
+        }
+        return *data;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void thread_description_profiler::begin_phase(phase_data& data)
+    {
+        if (hardware_counters_)
+        {
+            get_worker_data().read_hardware_counters(
+                data.cycles_, data.cache_misses_);
+        }
+        else
+        {
+            data.cycles_ = 0;
+            data.cache_misses_ = 0;
+        }
+
+        data.start_time_ = util::high_resolution_clock::now();
+    }
+
+    void thread_description_profiler::end_phase(thread_data* thrd,
+        phase_data const& data, bool suspended)
+    {
+        std::uint64_t exec_time =
+            util::high_resolution_clock::now() - data.start_time_;
+
+        worker_data& wd = get_worker_data();
+
+        std::uint64_t cycles = 0;
+        std::uint64_t cache_misses = 0;
+        if (hardware_counters_ &&
+            wd.read_hardware_counters(cycles, cache_misses))
+        {
+            cycles -= data.cycles_;
+            cache_misses -= data.cache_misses_;
+        }
+
+        // string literals and functions never share an address, thus both
+        // kinds of descriptions can be stored in the same map
+        util::thread_description desc = thrd->get_description();
+        std::size_t key =
+            desc.kind() == util::thread_description::data_type_description ?
+                reinterpret_cast<std::size_t>(desc.get_description()) :
+                desc.get_address();
+
+        std::lock_guard<mutex_type> l(wd.mtx_);
+
+        auto it = wd.entries_.find(key);
+        if (it == wd.entries_.end())
+        {
+            it = wd.entries_.emplace(key, worker_data::entry(desc)).first;
+        }
+
+        statistics& stats = it->second.stats_;
+        ++stats.phases_;
+        stats.exec_time_ += exec_time;
+        if (suspended)
+            ++stats.suspensions_;
+        stats.cycles_ += cycles;
+        stats.cache_misses_ += cache_misses;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::map<std::string, thread_description_profiler::statistics>
+    thread_description_profiler::collect(bool reset)
+    {
+        std::map<std::string, statistics> result;
+
+        std::lock_guard<mutex_type> l(mtx_);
+        for (std::unique_ptr<worker_data>& wd : workers_)
+        {
+            std::lock_guard<mutex_type> ll(wd->mtx_);
+            for (auto& e : wd->entries_)
+            {
+                statistics& stats = result[util::as_string(e.second.desc_)];
+                statistics& s = e.second.stats_;
+
+                stats.phases_ += s.phases_;
+                stats.exec_time_ += s.exec_time_;
+                stats.suspensions_ += s.suspensions_;
+                stats.cycles_ += s.cycles_;
+                stats.cache_misses_ += s.cache_misses_;
+
+                if (reset)
+                    s = statistics();
+            }
+        }
+        return result;
+    }
+
+    thread_description_profiler::statistics
+    thread_description_profiler::get_statistics(
+        std::string const& name, bool reset)
+    {
+        statistics result;
+
+        std::lock_guard<mutex_type> l(mtx_);
+        for (std::unique_ptr<worker_data>& wd : workers_)
+        {
+            std::lock_guard<mutex_type> ll(wd->mtx_);
+            for (auto& e : wd->entries_)
+            {
+                if (!name.empty() && util::as_string(e.second.desc_) != name)
+                    continue;
+
+                statistics& s = e.second.stats_;
+
+                result.phases_ += s.phases_;
+                result.exec_time_ += s.exec_time_;
+                result.suspensions_ += s.suspensions_;
+                result.cycles_ += s.cycles_;
+                result.cache_misses_ += s.cache_misses_;
+
+                if (reset)
+                    s = statistics();
+            }
+        }
+        return result;
+    }
+
+    std::int64_t thread_description_profiler::get_phases(
+        std::string const& name, bool reset)
+    {
+        return static_cast<std::int64_t>(
+            get_statistics(name, reset).phases_);
+    }
+
+    std::int64_t thread_description_profiler::get_exec_time(
+        std::string const& name, bool reset)
+    {
+        return static_cast<std::int64_t>(
+            get_statistics(name, reset).exec_time_);
+    }
+
+    std::int64_t thread_description_profiler::get_suspensions(
+        std::string const& name, bool reset)
+    {
+        return static_cast<std::int64_t>(
+            get_statistics(name, reset).suspensions_);
+    }
+
+    std::int64_t thread_description_profiler::get_cycles(
+        std::string const& name, bool reset)
+    {
+        return static_cast<std::int64_t>(
+            get_statistics(name, reset).cycles_);
+    }
+
+    std::int64_t thread_description_profiler::get_cache_misses(
+        std::string const& name, bool reset)
+    {
+        return static_cast<std::int64_t>(
+            get_statistics(name, reset).cache_misses_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void thread_description_profiler::print(std::ostream& os)
+    {
+        std::map<std::string, statistics> data = collect(false);
+
+        typedef std::pair<std::string, statistics> value_type;
+        std::vector<value_type> sorted(data.begin(), data.end());
+        std::sort(sorted.begin(), sorted.end(),
+            [](value_type const& lhs, value_type const& rhs)
+            {
+                return lhs.second.exec_time_ > rhs.second.exec_time_;
+            });
+
+        os << "description,phases,exec-time[ns],suspensions";
+        if (hardware_counters_)
+            os << ",cycles,cache-misses";
+        os << "\n";
+
+        for (value_type const& v : sorted)
+        {
+            util::format_to(os, "\"{}\",{},{},{}", v.first,
+                v.second.phases_, v.second.exec_time_,
+                v.second.suspensions_);
+            if (hardware_counters_)
+            {
+                util::format_to(os, ",{},{}",
+                    v.second.cycles_, v.second.cache_misses_);
+            }
+            os << "\n";
+        }
+        os << std::flush;
+    }
+
+    void thread_description_profiler::print_at_shutdown()
+    {
+        if (!enabled_ || !print_at_shutdown_)
+            return;
+
+        // the thread manager may be stopped more than once
+        print_at_shutdown_ = false;
+        print(std::cerr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool thread_description_profiler::counter_discoverer(
+        performance_counters::counter_info const& info,
+        performance_counters::counter_path_elements& p,
+        performance_counters::discover_counter_func const& f,
+        performance_counters::discover_counters_mode mode, error_code& ec)
+    {
+        if (mode == performance_counters::discover_counters_minimal ||
+            p.parentinstancename_.empty() || p.instancename_.empty())
+        {
+            if (p.parentinstancename_.empty())
+            {
+                p.parentinstancename_ = "locality#*";
+                p.parentinstanceindex_ = -1;
+            }
+
+            if (p.instancename_.empty())
+            {
+                p.instancename_ = "total";
+                p.instanceindex_ = -1;
+            }
+        }
+
+        // the thread descriptions are known only after the corresponding
+        // threads have been executed, thus any explicitly given description
+        // is accepted
+        if (p.parameters_.empty() ||
+            p.parameters_.find_first_of("*?[]") == std::string::npos)
+        {
+            std::string fullname;
+            performance_counters::get_counter_name(p, fullname, ec);
+            if (ec) return false;
+
+            performance_counters::counter_info cinfo = info;
+            cinfo.fullname_ = fullname;
+            return f(cinfo, ec) && !ec;
+        }
+
+        std::string str_rx(util::regex_from_pattern(p.parameters_, ec));
+        if (ec) return false;
+
+        std::regex rx(str_rx);
+        for (auto const& v : collect(false))
+        {
+            if (!std::regex_match(v.first, rx))
+                continue;
+
+            // propagate parameters
+            std::string fullname;
+            performance_counters::counter_path_elements cp = p;
+            cp.parameters_ = v.first;
+
+            performance_counters::get_counter_name(cp, fullname, ec);
+            if (ec) return false;
+
+            performance_counters::counter_info cinfo = info;
+            cinfo.fullname_ = fullname;
+
+            if (!f(cinfo, ec) || ec)
+                return false;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+}}}
+
+#endif
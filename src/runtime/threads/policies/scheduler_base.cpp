@@ -16,6 +16,8 @@
 #include <hpx/runtime/threads/thread_pool_base.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/util/safe_lexical_cast.hpp>
 #include <hpx/util/yield_while.hpp>
 #include <hpx/util_fwd.hpp>
@@ -43,6 +45,13 @@ namespace hpx { namespace threads { namespace policies
     scheduler_base::scheduler_base(std::size_t num_threads,
             char const* description, scheduler_mode mode)
       : modes_(num_threads)
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+      , wait_counts_(num_threads)
+      , parked_count_(0)
+      , max_idle_spin_rounds_(
+            hpx::util::safe_lexical_cast<std::uint32_t>(hpx::get_config_entry(
+                "hpx.max_idle_spin_rounds", HPX_IDLE_SPIN_ROUNDS_MAX)))
+#endif
       , suspend_mtxs_(num_threads)
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
@@ -58,10 +67,8 @@ namespace hpx { namespace threads { namespace policies
             hpx::util::safe_lexical_cast<double>(hpx::get_config_entry(
                 "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX));
 
-        wait_counts_.resize(num_threads);
         for (auto && data : wait_counts_)
         {
-            data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
 #endif
@@ -70,32 +77,94 @@ namespace hpx { namespace threads { namespace policies
             states_[i].store(state_initialized);
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    scheduler_base::idle_backoff_data::idle_backoff_data()
+      : wait_count_(0)
+      , max_idle_backoff_time_(HPX_IDLE_BACKOFF_TIME_MAX)
+      , idle_(false)
+      , spin_rounds_(0)
+      , max_spin_rounds_(1)
+      , notified_(false)
+      , notify_time_(0)
+      , parked_(false)
+      , parks_(0)
+      , unparks_(0)
+      , wake_latency_(0)
+      , wake_latency_count_(0)
+    {}
+#endif
+
     void scheduler_base::idle_callback(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         if (modes_[num_thread].data_.load(std::memory_order_relaxed) &
                 policies::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
-
             idle_backoff_data& data = wait_counts_[num_thread].data_;
+            data.idle_ = true;
+
+            // Keep spinning for a couple of idle rounds before parking this
+            // thread. The number of rounds adapts to how quickly new work has
+            // arrived after this thread was parked recently.
+            if (data.spin_rounds_ < data.max_spin_rounds_)
+            {
+                ++data.spin_rounds_;
+                return;
+            }
 
-            // Exponential back-off with a maximum sleep time.
+            // Park this thread for some time, additionally it gets woken up
+            // on new work. Exponential back-off with a maximum sleep time.
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
             std::chrono::milliseconds period(std::lround((std::min)(
                 data.max_idle_backoff_time_, std::pow(2.0, exponent))));
 
-            ++data.wait_count_;
+            std::unique_lock<pu_mutex_type> l(data.mtx_);
+
+            data.parked_.store(true, std::memory_order_relaxed);
+            ++parked_count_;
+
+            // pairs with the fence in do_some_work, either the producer
+            // sees this thread being parked or this thread sees the work
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Make sure no work was added before this thread became visible
+            // as being parked, as its producer could have missed to wake us.
+            bool has_work = has_thread_stealing(num_thread) ?
+                get_queue_length() != 0 : get_queue_length(num_thread) != 0;
+            if (!has_work)
+            {
+                ++data.parks_;
+                data.cond_.wait_for(l, period, [&]() { return data.notified_; });
+            }
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            data.parked_.store(false, std::memory_order_relaxed);
+            --parked_count_;
+
+            if (data.notified_)
             {
-                // reset counter if thread was woken up
+                data.notified_ = false;
+                ++data.unparks_;
+                ++data.wake_latency_count_;
+                data.wake_latency_ += static_cast<std::int64_t>(
+                    util::high_resolution_clock::now() - data.notify_time_);
+
+                // Work has arrived before the shortest back-off period has
+                // expired, spin longer next time.
+                if (data.wait_count_ == 0)
+                {
+                    data.max_spin_rounds_ = (std::min)(
+                        2 * data.max_spin_rounds_ + 1, max_idle_spin_rounds_);
+                }
                 data.wait_count_ = 0;
             }
+            else if (!has_work)
+            {
+                // no work has arrived, spin less next time
+                ++data.wait_count_;
+                data.max_spin_rounds_ /= 2;
+            }
         }
 #else
         (void)num_thread;
@@ -116,13 +185,124 @@ namespace hpx { namespace threads { namespace policies
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // pairs with the fence in idle_callback preceding the re-check of
+        // the queue lengths
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_count_.load(std::memory_order_seq_cst) == 0)
+            return;
+
+        // Prefer waking the thread the new work was scheduled for, otherwise
+        // wake any other parked thread as the work might be stolen. The
+        // given number is a scheduling hint which isn't necessarily a
+        // thread number of this pool, map it the same way as the schedulers
+        // map hints to their queues.
+        std::size_t const num_threads = wait_counts_.size();
+        std::size_t const start = num_thread == std::size_t(-1) ?
+            0 : num_thread % num_threads;
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            idle_backoff_data& data =
+                wait_counts_[(start + i) % num_threads].data_;
+            if (!data.parked_.load(std::memory_order_relaxed))
+                continue;
+
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+            if (data.parked_.load(std::memory_order_relaxed) &&
+                !data.notified_)
+            {
+                data.notified_ = true;
+                data.notify_time_ = util::high_resolution_clock::now();
+                data.cond_.notify_one();
+                return;
+            }
+        }
+#else
+        (void)num_thread;
+#endif
+    }
+
+    void scheduler_base::do_some_work_all()
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        cond_.notify_all();
+        for (auto& d : wait_counts_)
+        {
+            idle_backoff_data& data = d.data_;
+
+            std::lock_guard<pu_mutex_type> l(data.mtx_);
+            if (data.parked_.load(std::memory_order_relaxed) &&
+                !data.notified_)
+            {
+                data.notified_ = true;
+                data.notify_time_ = util::high_resolution_clock::now();
+                data.cond_.notify_one();
+            }
+        }
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::int64_t scheduler_base::get_num_parks(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            return util::get_and_reset_value(
+                wait_counts_[num_thread].data_.parks_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : wait_counts_)
+            result += util::get_and_reset_value(data.data_.parks_, reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_num_unparks(
+        std::size_t num_thread, bool reset)
+    {
+        if (num_thread != std::size_t(-1))
+        {
+            return util::get_and_reset_value(
+                wait_counts_[num_thread].data_.unparks_, reset);
+        }
+
+        std::int64_t result = 0;
+        for (auto& data : wait_counts_)
+            result += util::get_and_reset_value(data.data_.unparks_, reset);
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_average_wake_latency(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t count = 0;
+        std::int64_t latency = 0;
+
+        std::size_t first = num_thread;
+        std::size_t last = num_thread + 1;
+        if (num_thread == std::size_t(-1))
+        {
+            first = 0;
+            last = wait_counts_.size();
+        }
+
+        for (std::size_t i = first; i != last; ++i)
+        {
+            idle_backoff_data& data = wait_counts_[i].data_;
+            // the number of wake-ups is tallied separately, resetting this
+            // counter must not affect /threads/count/worker-unparks
+            count += util::get_and_reset_value(
+                data.wake_latency_count_, reset);
+            latency += util::get_and_reset_value(data.wake_latency_, reset);
+        }
+
+        return count == 0 ? 0 : latency / count;
+    }
+#endif
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -330,7 +510,7 @@ namespace hpx { namespace threads { namespace policies
         {
             m.data_.store(mode, std::memory_order_release);
         }
-        do_some_work(std::size_t(-1));
+        do_some_work_all();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
@@ -341,7 +521,7 @@ namespace hpx { namespace threads { namespace policies
         {
             m.data_.store(mode, std::memory_order_release);
         }
-        do_some_work(std::size_t(-1));
+        do_some_work_all();
     }
 
     void scheduler_base::add_remove_scheduler_mode(
@@ -354,7 +534,7 @@ namespace hpx { namespace threads { namespace policies
         {
             m.data_.store(mode, std::memory_order_release);
         }
-        do_some_work(std::size_t(-1));
+        do_some_work_all();
     }
 
     void scheduler_base::remove_scheduler_mode(scheduler_mode mode)
@@ -365,7 +545,7 @@ namespace hpx { namespace threads { namespace policies
         {
             m.data_.store(mode, std::memory_order_release);
         }
-        do_some_work(std::size_t(-1));
+        do_some_work_all();
     }
 
     bool scheduler_base::has_thread_stealing(std::size_t num_thread) const
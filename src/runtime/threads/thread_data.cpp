@@ -164,6 +164,12 @@ namespace hpx { namespace threads
         return id ? id->get_stack_size() : 0;
     }
 
+    bool is_self_stackless()
+    {
+        thread_self* self = get_self_ptr();
+        return self != nullptr && self->is_stackless();
+    }
+
 #ifndef HPX_HAVE_THREAD_PARENT_REFERENCE
     thread_id_type get_parent_id()
     {
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -475,6 +476,19 @@ namespace hpx { namespace this_thread
         threads::thread_self& self = threads::get_self();
         threads::thread_id_type id = self.get_thread_id();
 
+        // stackless threads run on the stack of the scheduling thread, they
+        // can't be suspended
+        if (self.is_stackless())
+        {
+            std::ostringstream strm;
+            strm << "thread(" << threads::get_self_id() << ", "
+                  << threads::get_thread_description(id)
+                  << ") is stackless and can't be suspended, use a thread "
+                     "with a stack instead";
+            HPX_THROWS_IF(ec, invalid_status, "suspend", strm.str());
+            return threads::wait_unknown;
+        }
+
         // handle interruption, if needed
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
@@ -537,6 +551,19 @@ namespace hpx { namespace this_thread
         threads::thread_self& self = threads::get_self();
         threads::thread_id_type id = self.get_thread_id();
 
+        // stackless threads run on the stack of the scheduling thread, they
+        // can't be suspended
+        if (self.is_stackless())
+        {
+            std::ostringstream strm;
+            strm << "thread(" << threads::get_self_id() << ", "
+                  << threads::get_thread_description(id)
+                  << ") is stackless and can't be suspended, use a thread "
+                     "with a stack instead";
+            HPX_THROWS_IF(ec, invalid_status, "suspend_at", strm.str());
+            return threads::wait_unknown;
+        }
+
         // handle interruption, if needed
         threads::interruption_point(id, ec);
         if (ec) return threads::wait_unknown;
@@ -669,4 +696,20 @@ namespace hpx { namespace this_thread
         return true;
 #endif
     }
+
+    std::int64_t get_local_queue_length()
+    {
+        if (nullptr == hpx::threads::get_self_ptr())
+            return 0;
+
+        threads::policies::scheduler_base* scheduler =
+            threads::get_self_id()->get_scheduler_base();
+
+        std::size_t num_thread = hpx::get_worker_thread_num();
+        if (num_thread == std::size_t(-1))
+            return 0;
+
+        return scheduler->get_queue_length(
+            scheduler->global_to_local_thread_index(num_thread));
+    }
 }}
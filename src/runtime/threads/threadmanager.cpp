@@ -20,8 +20,10 @@
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/resource/detail/partitioner.hpp>
 #include <hpx/runtime/thread_pool_helpers.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/runtime/threads/detail/scheduled_thread_pool.hpp>
 #include <hpx/runtime/threads/detail/set_thread_state.hpp>
+#include <hpx/runtime/threads/detail/thread_description_profiler.hpp>
 #include <hpx/runtime/threads/executors/current_executor.hpp>
 #include <hpx/runtime/threads/policies/schedulers.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
@@ -30,6 +32,7 @@
 #include <hpx/runtime/threads/threadmanager.hpp>
 #include <hpx/runtime/threads/topology.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
 #include <hpx/util/bind_back.hpp>
 #include <hpx/util/bind_front.hpp>
 #include <hpx/util/block_profiler.hpp>
@@ -39,6 +42,7 @@
 #include <hpx/util/logging.hpp>
 #include <hpx/util/runtime_configuration.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -243,7 +247,7 @@ namespace hpx { namespace threads
 
     namespace strings {
         char const* const stack_size_names[] = {
-            "small", "medium", "large", "huge",
+            "small", "medium", "large", "huge", "current", "nostack"
         };
     }
 
@@ -261,9 +265,14 @@ namespace hpx { namespace threads
             size = thread_stacksize_large;
         else if (rtcfg.get_stack_size(thread_stacksize_huge) == size)
             size = thread_stacksize_huge;
+        else if (rtcfg.get_stack_size(thread_stacksize_nostack) == size)
+            size = thread_stacksize_nostack;
 
-        if (size < thread_stacksize_small || size > thread_stacksize_huge)
+        if (size < thread_stacksize_small || size > thread_stacksize_nostack ||
+            size == thread_stacksize_current)
+        {
             return "custom";
+        }
 
         return strings::stack_size_names[size - 1];
     }
@@ -361,6 +370,44 @@ namespace hpx { namespace threads
                 break;
             }
 
+            case resource::local_chase_lev:
+            {
+#if defined(HPX_HAVE_LOCAL_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                hpx::detail::ensure_high_priority_compatibility(cfg_.vm_);
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler
+                typedef hpx::threads::policies::local_queue_scheduler<
+                    compat::mutex, hpx::threads::policies::lockfree_chase_lev>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    1000, numa_sensitive,
+                    "core-local_chase_lev_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=local-chase-lev "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=local'.");
+#endif
+                break;
+            }
+
             case resource::local_priority_fifo:
             {
                 // set parameters for scheduler and pool instantiation and
@@ -427,6 +474,74 @@ namespace hpx { namespace threads
                 break;
             }
 
+            case resource::local_priority_chase_lev:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::detail::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler
+                typedef hpx::threads::policies::local_priority_queue_scheduler<
+                    compat::mutex, hpx::threads::policies::lockfree_chase_lev>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    num_high_priority_queues, 1000, numa_sensitive,
+                    "core-local_priority_chase_lev_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+
+                break;
+            }
+
+            case resource::edf:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::detail::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+                std::string affinity_desc;
+                std::size_t numa_sensitive =
+                    hpx::detail::get_affinity_description(cfg_, affinity_desc);
+
+                // instantiate the scheduler, both the pending and the staged
+                // queues are ordered by the deadline of their items
+                typedef hpx::threads::policies::local_priority_queue_scheduler<
+                    compat::mutex, hpx::threads::policies::edf_queue,
+                    hpx::threads::policies::edf_queue>
+                    local_sched_type;
+                local_sched_type::init_parameter_type init(num_threads_in_pool,
+                    num_high_priority_queues, 1000, numa_sensitive,
+                    "core-edf_queue_scheduler");
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                            local_sched_type
+                        >(std::move(sched),
+                        notifier_, i, name.c_str(), scheduler_mode,
+                        thread_offset));
+                pools_.push_back(std::move(pool));
+
+                break;
+            }
+
             case resource::static_:
             {
 #if defined(HPX_HAVE_STATIC_SCHEDULER)
@@ -1014,6 +1129,93 @@ namespace hpx { namespace threads
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_steal_batches(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_steal_batches(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_steal_batch_size(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_average_steal_batch_size(
+                all_threads, reset);
+        }
+        return result / (std::max)(std::size_t(1), pools_.size());
+    }
+
+    std::int64_t threadmanager::get_max_steal_batch_size(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result = (std::max)(result,
+                pool_iter->get_max_steal_batch_size(all_threads, reset));
+        }
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_core(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_core(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_numa_domain(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_num_stolen_from_numa_domain(
+                all_threads, reset);
+        }
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_remote_numa_domain(
+        bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_num_stolen_from_remote_numa_domain(
+                all_threads, reset);
+        }
+        return result;
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::int64_t threadmanager::get_num_parks(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_parks(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_unparks(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_unparks(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_average_wake_latency(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_average_wake_latency(all_threads, reset);
+        return result / (std::max)(std::size_t(1), pools_.size());
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1373,6 +1575,23 @@ namespace hpx { namespace threads
                 util::bind_front(
                     &coroutine_type::impl_type::get_stack_unbind_count),
                 util::function_nonser<std::uint64_t(bool)>(), "", 0},
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+            // /threads{locality#%d/total}/count/stack-allocations
+            {"count/stack-allocations",
+                util::bind_front(
+                    &coroutines::detail::posix::get_stack_allocation_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-reuses
+            {"count/stack-reuses",
+                util::bind_front(
+                    &coroutines::detail::posix::get_stack_reuse_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-trims
+            {"count/stack-trims",
+                util::bind_front(
+                    &coroutines::detail::posix::get_stack_trim_count),
+                util::function_nonser<std::uint64_t(bool)>(), "", 0},
 #endif
         };
         std::size_t const data_size = sizeof(data)/sizeof(data[0]);
@@ -1642,6 +1861,25 @@ namespace hpx { namespace threads
                 "operations performed for the referenced locality",
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &performance_counters::locality_counter_discoverer, ""},
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+            {"/threads/count/stack-allocations",
+                performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks allocated "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/threads/count/stack-reuses", performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks reused from "
+                "the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
+            {"/threads/count/stack-trims", performance_counters::counter_raw,
+                "returns the total number of HPX-thread stacks released "
+                "(madvise or munmap) by the stack pool for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &performance_counters::locality_counter_discoverer, ""},
 #endif
             {"/threads/count/objects", performance_counters::counter_raw,
                 "returns the overall number of created HPX-thread objects for "
@@ -1714,6 +1952,105 @@ namespace hpx { namespace threads
                     &thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {"/threads/count/steal-batches",
+                performance_counters::counter_raw,
+                "returns the overall number of successful steal operations "
+                "(each of which might have moved several HPX-threads or task "
+                "descriptions) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_steal_batches,
+                    &thread_pool_base::get_num_steal_batches),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/average-steal-batch-size",
+                performance_counters::counter_raw,
+                "returns the average number of HPX-threads or task "
+                "descriptions moved by a successful steal operation for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_average_steal_batch_size,
+                    &thread_pool_base::get_average_steal_batch_size),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/max-steal-batch-size",
+                performance_counters::counter_raw,
+                "returns the largest number of HPX-threads or task "
+                "descriptions moved by a single steal operation for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_max_steal_batch_size,
+                    &thread_pool_base::get_max_steal_batch_size),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-core",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from schedulers running on the same core "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_core,
+                    &thread_pool_base::get_num_stolen_from_core),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-numa-domain",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from schedulers running on other cores "
+                "of the same NUMA domain for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_numa_domain,
+                    &thread_pool_base::get_num_stolen_from_numa_domain),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/stolen-from-remote-numa-domain",
+                performance_counters::counter_raw,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from schedulers running in other NUMA "
+                "domains for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_stolen_from_remote_numa_domain,
+                    &thread_pool_base::get_num_stolen_from_remote_numa_domain),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+#endif
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            {"/threads/count/worker-parks",
+                performance_counters::counter_raw,
+                "returns the overall number of times worker threads were parked "
+                "because of being idle for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_parks,
+                    &thread_pool_base::get_num_parks),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/count/worker-unparks",
+                performance_counters::counter_raw,
+                "returns the overall number of times parked worker threads were "
+                "woken up because of new work for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_num_unparks,
+                    &thread_pool_base::get_num_unparks),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {"/threads/time/average-wake-latency",
+                performance_counters::counter_raw,
+                "returns the average time between new work being announced "
+                "and a parked worker thread having woken up for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&threadmanager::locality_pool_thread_counter_creator,
+                    this, &threadmanager::get_average_wake_latency,
+                    &thread_pool_base::get_average_wake_latency),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
 #endif
             // scheduler utilization
             {"/scheduler/utilization/instantaneous",
@@ -1748,6 +2085,96 @@ namespace hpx { namespace threads
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types)/sizeof(counter_types[0]));
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        detail::thread_description_profiler& profiler =
+            detail::thread_description_profiler::instance();
+
+        performance_counters::generic_counter_type_data
+            thread_description_counter_types[] = {
+            // cumulative execution time per thread description
+            {"/threads/time/per-description", performance_counters::counter_raw,
+                "returns the cumulative execution time of all HPX threads with "
+                "the given description (the description has to be specified "
+                "as the counter parameter, requires "
+                "hpx.thread_profiling.enabled=1)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(
+                    &performance_counters::thread_description_counter_creator,
+                    _1, util::bind_front(
+                        &detail::thread_description_profiler::get_exec_time,
+                        &profiler), _2),
+                &performance_counters::thread_description_counter_discoverer,
+                "ns"},
+            // number of executed phases per thread description
+            {"/threads/count/per-description/phases",
+                performance_counters::counter_raw,
+                "returns the number of executed phases of all HPX threads with "
+                "the given description (the description has to be specified "
+                "as the counter parameter, requires "
+                "hpx.thread_profiling.enabled=1)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(
+                    &performance_counters::thread_description_counter_creator,
+                    _1, util::bind_front(
+                        &detail::thread_description_profiler::get_phases,
+                        &profiler), _2),
+                &performance_counters::thread_description_counter_discoverer,
+                ""},
+            // number of suspensions per thread description
+            {"/threads/count/per-description/suspensions",
+                performance_counters::counter_raw,
+                "returns the number of suspensions of all HPX threads with "
+                "the given description (the description has to be specified "
+                "as the counter parameter, requires "
+                "hpx.thread_profiling.enabled=1)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(
+                    &performance_counters::thread_description_counter_creator,
+                    _1, util::bind_front(
+                        &detail::thread_description_profiler::get_suspensions,
+                        &profiler), _2),
+                &performance_counters::thread_description_counter_discoverer,
+                ""},
+            // number of CPU cycles per thread description
+            {"/threads/count/per-description/cycles",
+                performance_counters::counter_raw,
+                "returns the number of CPU cycles spent executing all HPX "
+                "threads with the given description (the description has to "
+                "be specified as the counter parameter, requires "
+                "hpx.thread_profiling.hardware_counters=1)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(
+                    &performance_counters::thread_description_counter_creator,
+                    _1, util::bind_front(
+                        &detail::thread_description_profiler::get_cycles,
+                        &profiler), _2),
+                &performance_counters::thread_description_counter_discoverer,
+                ""},
+            // number of cache misses per thread description
+            {"/threads/count/per-description/cache-misses",
+                performance_counters::counter_raw,
+                "returns the number of cache misses caused by executing all "
+                "HPX threads with the given description (the description has "
+                "to be specified as the counter parameter, requires "
+                "hpx.thread_profiling.hardware_counters=1)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(
+                    &performance_counters::thread_description_counter_creator,
+                    _1, util::bind_front(
+                        &detail::thread_description_profiler::get_cache_misses,
+                        &profiler), _2),
+                &performance_counters::thread_description_counter_discoverer,
+                ""}
+        };
+        performance_counters::install_counter_types(
+            thread_description_counter_types,
+            sizeof(thread_description_counter_types) /
+                sizeof(thread_description_counter_types[0]));
+#endif
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -1783,6 +2210,10 @@ namespace hpx { namespace threads
         auto& rp = hpx::resource::get_partitioner();
         init_tss(rp.get_num_threads());
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        detail::thread_description_profiler::instance().init();
+#endif
+
 #ifdef HPX_HAVE_TIMER_POOL
         LTM_(info) << "run: running timer pool";
         timer_pool_.run(false);
@@ -1826,6 +2257,11 @@ namespace hpx { namespace threads
             pool_iter->stop(lk, blocking);
         }
         deinit_tss();
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        if (blocking)
+            detail::thread_description_profiler::instance().print_at_shutdown();
+#endif
     }
 
     void threadmanager::suspend()
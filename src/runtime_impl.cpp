@@ -270,6 +270,9 @@ namespace hpx
 
         parcel_handler_.enable_alternative_parcelports();
 
+        // connect to the other localities right away, if requested
+        parcel_handler_.prewarm_connections();
+
         // reset all counters right before running main, if requested
         if (get_config_entry("hpx.print_counter.startup", "0") == "1")
         {
@@ -0,0 +1,411 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/checkpoint_file.hpp>
+#include <hpx/util/format.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/predef/other/endian.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util
+{
+    namespace detail
+    {
+        // The fixed size header at the beginning of a checkpoint file, the
+        // serialized index of the sections follows right after it.
+        struct checkpoint_file_header
+        {
+            char magic_[8];
+            std::uint32_t format_version_;
+            std::uint32_t big_endian_;
+            std::uint64_t alignment_;
+            std::uint64_t index_size_;
+        };
+
+        static char const checkpoint_file_magic[8] = {
+            'H', 'P', 'X', 'C', 'K', 'P', 'T', '\0'
+        };
+
+        // Version of the file layout, files written by a newer version are
+        // rejected.
+        static std::uint32_t const checkpoint_file_format_version = 1;
+
+        // The byte order of this platform as stored in the file header
+#if BOOST_ENDIAN_BIG_BYTE
+        static std::uint32_t const checkpoint_file_big_endian = 1;
+#else
+        static std::uint32_t const checkpoint_file_big_endian = 0;
+#endif
+
+        static std::uint64_t align_offset(std::uint64_t offset,
+            std::uint64_t alignment)
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        // Write the given data to its place in the (already sized) file
+        static void write_checkpoint_section(std::string const& filename,
+            std::uint64_t offset, char const* data, std::uint64_t size)
+        {
+            std::fstream out(filename,
+                std::ios::in | std::ios::out | std::ios::binary);
+            out.seekp(static_cast<std::streamoff>(offset));
+            out.write(data, static_cast<std::streamsize>(size));
+            if (!out)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "checkpoint_file_writer::write",
+                    hpx::util::format(
+                        "failed writing checkpoint file: {}", filename));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct checkpoint_file_writer::section
+    {
+        checkpoint_section_info info_;
+
+        // serialized sections are owned, arrays refer to the caller's data
+        hpx::future<std::vector<char> > serialized_;
+        std::vector<char> data_;
+        void const* array_;
+    };
+
+    checkpoint_file_writer::checkpoint_file_writer(std::size_t alignment)
+      : alignment_(alignment)
+    {
+        if (alignment_ == 0 || (alignment_ & (alignment_ - 1)) != 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_file_writer::checkpoint_file_writer",
+                hpx::util::format("the alignment of the sections of a "
+                    "checkpoint file must be a power of two: {}", alignment));
+        }
+    }
+
+    void checkpoint_file_writer::add_serialized_section(
+        std::string const& name, std::uint32_t version,
+        std::string const& compression,
+        hpx::future<std::vector<char> >&& data)
+    {
+        std::shared_ptr<section> s = std::make_shared<section>();
+        s->info_.name_ = name;
+        s->info_.version_ = version;
+        s->info_.compression_ = compression;
+        s->serialized_ = std::move(data);
+        s->array_ = nullptr;
+
+        sections_.push_back(std::move(s));
+    }
+
+    void checkpoint_file_writer::add_array_section(std::string const& name,
+        std::uint32_t version, void const* data, std::size_t element_size,
+        std::size_t count)
+    {
+        std::shared_ptr<section> s = std::make_shared<section>();
+        s->info_.name_ = name;
+        s->info_.version_ = version;
+        s->info_.size_ = element_size * count;
+        s->info_.element_size_ = element_size;
+        s->array_ = data;
+
+        sections_.push_back(std::move(s));
+    }
+
+    hpx::future<void> checkpoint_file_writer::write(std::string const& filename)
+    {
+        typedef std::vector<std::shared_ptr<section> > sections_type;
+
+        std::vector<hpx::future<std::vector<char> > > serialized;
+        for (std::shared_ptr<section>& s : sections_)
+        {
+            if (s->serialized_.valid())
+                serialized.push_back(std::move(s->serialized_));
+        }
+
+        std::shared_ptr<sections_type> sections =
+            std::make_shared<sections_type>(std::move(sections_));
+        sections_.clear();
+
+        std::uint64_t const alignment = alignment_;
+
+        return hpx::when_all(std::move(serialized)).then(
+            [sections, filename, alignment](
+                hpx::future<std::vector<hpx::future<std::vector<char> > > >
+                    && f)
+            {
+                // collect the serialized data, rethrows serialization errors
+                std::vector<hpx::future<std::vector<char> > > serialized =
+                    f.get();
+
+                std::size_t i = 0;
+                for (std::shared_ptr<section>& s : *sections)
+                {
+                    if (s->array_ == nullptr)
+                    {
+                        s->data_ = serialized[i++].get();
+                        s->info_.size_ = s->data_.size();
+                    }
+                }
+
+                // the index has a fixed size, assign offsets before
+                // serializing it
+                std::vector<checkpoint_section_info> index;
+                index.reserve(sections->size());
+                for (std::shared_ptr<section> const& s : *sections)
+                    index.push_back(s->info_);
+
+                std::vector<char> index_data;
+                {
+                    hpx::serialization::output_archive ar(index_data);
+                    ar << index;
+                }
+
+                std::uint64_t offset = detail::align_offset(
+                    sizeof(detail::checkpoint_file_header) +
+                        index_data.size(),
+                    alignment);
+                for (std::size_t j = 0; j != index.size(); ++j)
+                {
+                    index[j].offset_ = offset;
+                    (*sections)[j]->info_.offset_ = offset;
+                    offset = detail::align_offset(
+                        offset + index[j].size_, alignment);
+                }
+
+                index_data.clear();
+                {
+                    hpx::serialization::output_archive ar(index_data);
+                    ar << index;
+                }
+
+                // write the header and the index and size the file
+                detail::checkpoint_file_header header;
+                std::memcpy(header.magic_, detail::checkpoint_file_magic,
+                    sizeof(header.magic_));
+                header.format_version_ =
+                    detail::checkpoint_file_format_version;
+                header.big_endian_ = detail::checkpoint_file_big_endian;
+                header.alignment_ = alignment;
+                header.index_size_ = index_data.size();
+
+                {
+                    std::ofstream out(filename,
+                        std::ios::out | std::ios::trunc | std::ios::binary);
+                    out.write(reinterpret_cast<char const*>(&header),
+                        sizeof(header));
+                    out.write(index_data.data(),
+                        static_cast<std::streamsize>(index_data.size()));
+                    if (offset > static_cast<std::uint64_t>(out.tellp()))
+                    {
+                        out.seekp(static_cast<std::streamoff>(offset - 1));
+                        out.put('\0');
+                    }
+                    if (!out)
+                    {
+                        HPX_THROW_EXCEPTION(filesystem_error,
+                            "checkpoint_file_writer::write",
+                            hpx::util::format(
+                                "failed writing checkpoint file: {}",
+                                filename));
+                    }
+                }
+
+                // write all sections in parallel
+                std::vector<hpx::future<void> > writes;
+                writes.reserve(sections->size());
+                for (std::shared_ptr<section> const& s : *sections)
+                {
+                    if (s->info_.size_ == 0)
+                        continue;
+
+                    char const* data = s->array_ != nullptr ?
+                        static_cast<char const*>(s->array_) : s->data_.data();
+
+                    writes.push_back(hpx::async(
+                        &detail::write_checkpoint_section, filename,
+                        s->info_.offset_, data, s->info_.size_));
+                }
+
+                hpx::wait_all(writes);
+                for (hpx::future<void>& w : writes)
+                    w.get();
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct checkpoint_file::mapping
+    {
+        explicit mapping(std::string const& filename)
+          : file_(filename.c_str(), boost::interprocess::read_only)
+          , region_(file_, boost::interprocess::read_only)
+        {}
+
+        boost::interprocess::file_mapping file_;
+        boost::interprocess::mapped_region region_;
+    };
+
+    checkpoint_file::checkpoint_file(std::string const& filename)
+      : data_(nullptr), size_(0)
+    {
+        try {
+            mapping_.reset(new mapping(filename));
+        }
+        catch (boost::interprocess::interprocess_exception const& e) {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "checkpoint_file::checkpoint_file",
+                hpx::util::format("failed mapping checkpoint file {}: {}",
+                    filename, e.what()));
+        }
+
+        data_ = static_cast<char const*>(mapping_->region_.get_address());
+        size_ = mapping_->region_.get_size();
+
+        detail::checkpoint_file_header header;
+        if (size_ < sizeof(header))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "checkpoint_file::checkpoint_file",
+                hpx::util::format("not a checkpoint file: {}", filename));
+        }
+        std::memcpy(&header, data_, sizeof(header));
+
+        if (std::memcmp(header.magic_, detail::checkpoint_file_magic,
+                sizeof(header.magic_)) != 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "checkpoint_file::checkpoint_file",
+                hpx::util::format("not a checkpoint file: {}", filename));
+        }
+
+        // arrays (and the header) are stored in the byte order of the
+        // writer and can't be used directly on a different platform
+        if (header.big_endian_ != detail::checkpoint_file_big_endian ||
+            header.format_version_ > detail::checkpoint_file_format_version)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "checkpoint_file::checkpoint_file",
+                hpx::util::format("unsupported checkpoint file format "
+                    "(version or byte order): {}", filename));
+        }
+
+        if (header.index_size_ > size_ - sizeof(header))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "checkpoint_file::checkpoint_file",
+                hpx::util::format("checkpoint file is truncated: {}",
+                    filename));
+        }
+
+        detail::checkpoint_section_data index_data(data_ + sizeof(header),
+            static_cast<std::size_t>(header.index_size_));
+        {
+            hpx::serialization::input_archive ar(
+                index_data, index_data.size());
+            ar >> sections_;
+        }
+
+        for (checkpoint_section_info const& s : sections_)
+        {
+            if (s.offset_ > size_ || s.size_ > size_ - s.offset_)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "checkpoint_file::checkpoint_file",
+                    hpx::util::format("checkpoint file is truncated: {}",
+                        filename));
+            }
+        }
+    }
+
+    checkpoint_file::~checkpoint_file() = default;
+
+    bool checkpoint_file::has_section(std::string const& name) const
+    {
+        for (checkpoint_section_info const& s : sections_)
+        {
+            if (s.name_ == name)
+                return true;
+        }
+        return false;
+    }
+
+    checkpoint_section_info const& checkpoint_file::get_section_info(
+        std::string const& name) const
+    {
+        for (checkpoint_section_info const& s : sections_)
+        {
+            if (s.name_ == name)
+                return s;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "checkpoint_file::get_section_info",
+            hpx::util::format("no such checkpoint section: {}", name));
+        return sections_.front();
+    }
+
+    detail::checkpoint_section_data checkpoint_file::get_serialized_section(
+        std::string const& name) const
+    {
+        checkpoint_section_info const& s = get_section_info(name);
+        if (s.is_array())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_file::restore_section",
+                hpx::util::format("checkpoint section {} holds an array, "
+                    "use get_array or restore_array", name));
+        }
+
+        return detail::checkpoint_section_data(
+            data_ + s.offset_, static_cast<std::size_t>(s.size_));
+    }
+
+    void const* checkpoint_file::get_array_section(std::string const& name,
+        std::size_t element_size, std::size_t alignment,
+        std::size_t& count) const
+    {
+        checkpoint_section_info const& s = get_section_info(name);
+        if (s.element_size_ != element_size)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_file::get_array",
+                hpx::util::format("checkpoint section {} does not hold an "
+                    "array of elements of size {}", name, element_size));
+        }
+
+        char const* data = data_ + s.offset_;
+        if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "checkpoint_file::get_array",
+                hpx::util::format("checkpoint section {} is not sufficiently "
+                    "aligned for the requested element type", name));
+        }
+
+        count = static_cast<std::size_t>(s.size_ / element_size);
+        return data;
+    }
+}}
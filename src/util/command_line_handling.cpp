@@ -276,11 +276,11 @@ namespace hpx { namespace util
             {
                 std::size_t numa_sensitive =
                     vm["hpx:numa-sensitive"].as<std::size_t>();
-                if (numa_sensitive > 2)
+                if (numa_sensitive > 3)
                 {
                     throw hpx::detail::command_line_error("Invalid argument "
                         "value for --hpx:numa-sensitive. Allowed values are "
-                        "0, 1, or 2");
+                        "0, 1, 2, or 3");
                 }
                 return numa_sensitive;
             }
@@ -446,6 +446,7 @@ namespace hpx { namespace util
                 ("hpx:queuing", value<std::string>(),
                   "the queue scheduling policy to use, options are "
                   "'local', 'local-priority-fifo','local-priority-lifo', "
+                  "'local-chase-lev', 'local-priority-chase-lev', 'edf', "
                   "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
                   "'static-priority' (default: 'local-priority'; "
                   "all option values can be abbreviated)")
@@ -458,7 +459,9 @@ namespace hpx { namespace util
                   "makes the local-priority scheduler NUMA sensitive ("
                   "allowed values: 0 - no NUMA sensitivity, 1 - allow only for "
                   "boundary cores to steal across NUMA domains, 2 - "
-                  "no cross boundary stealing is allowed (default value: 0)")
+                  "no cross boundary stealing is allowed, 3 - hierarchical "
+                  "stealing, all cores steal across NUMA domains after a "
+                  "back-off (default value: 0)")
             ;
 
             options_description config_options("HPX configuration options");
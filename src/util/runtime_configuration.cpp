@@ -11,6 +11,7 @@
 #include <hpx/pp/expand.hpp>
 #include <hpx/pp/stringize.hpp>
 #include <hpx/runtime/parcelset/parcelhandler.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/find_prefix.hpp>
 #include <hpx/util/init_ini_data.hpp>
@@ -33,6 +34,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -78,6 +80,10 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_EXPORT bool use_guard_pages = true;
+
+        // this global variable is used to control whether stacks should be
+        // backed by (transparent) huge pages
+        HPX_EXPORT bool use_huge_pages = false;
     }
 }}}}
 #endif
@@ -199,6 +205,8 @@ namespace hpx { namespace util
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
             "max_idle_backoff_time = ${HPX_MAX_IDLE_BACKOFF_TIME:"
             HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
+            "max_idle_spin_rounds = ${HPX_MAX_IDLE_SPIN_ROUNDS:"
+            HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_IDLE_SPIN_ROUNDS_MAX)) "}",
 #endif
 
             /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
@@ -218,6 +226,14 @@ namespace hpx { namespace util
             "[hpx.on_startup]",
             "wait_on_latch = ${HPX_ON_STARTUP_WAIT_ON_LATCH}",
 
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            // collect execution statistics per thread description
+            "[hpx.thread_profiling]",
+            "enabled = ${HPX_THREAD_PROFILING:0}",
+            "hardware_counters = ${HPX_THREAD_PROFILING_HARDWARE_COUNTERS:0}",
+            "print_at_shutdown = ${HPX_THREAD_PROFILING_PRINT_AT_SHUTDOWN:1}",
+#endif
+
 #if defined(HPX_HAVE_NETWORKING)
             // by default, enable networking
             "[hpx.parcel]",
@@ -235,6 +251,12 @@ namespace hpx { namespace util
                 HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "use_huge_pages = ${HPX_USE_HUGE_PAGES:0}",
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+            "pool_high_watermark = ${HPX_STACK_POOL_HIGH_WATERMARK:0}",
+            "pool_low_watermark = ${HPX_STACK_POOL_LOW_WATERMARK:64}",
+            "use_madv_free = ${HPX_USE_MADV_FREE:0}",
 #endif
 
             "[hpx.threadpools]",
@@ -261,6 +283,9 @@ namespace hpx { namespace util
             "max_delete_count = ${HPX_THREAD_QUEUE_MAX_DELETE_COUNT:1000}",
             "max_terminated_threads = ${HPX_SCHEDULER_MAX_TERMINATED_THREADS:"
               HPX_PP_STRINGIZE(HPX_PP_EXPAND(HPX_SCHEDULER_MAX_TERMINATED_THREADS)) "}",
+            "lockfree_recycling = ${HPX_THREAD_QUEUE_LOCKFREE_RECYCLING:0}",
+            "remote_steal_backoff = ${HPX_THREAD_QUEUE_REMOTE_STEAL_BACKOFF:16}",
+            "max_steal_batch_size = ${HPX_THREAD_QUEUE_MAX_STEAL_BATCH_SIZE:1}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -574,6 +599,11 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::use_huge_pages =
+            init_use_huge_pages();
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+        init_stack_pool();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -635,6 +665,11 @@ namespace hpx { namespace util
 #if defined(__linux) || defined(linux) || defined(__linux__) || defined(__FreeBSD__)
         threads::coroutines::detail::posix::use_guard_pages =
             init_use_stack_guard_pages();
+        threads::coroutines::detail::posix::use_huge_pages =
+            init_use_huge_pages();
+#endif
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+        init_stack_pool();
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
         if (enable_lock_detection())
@@ -1054,6 +1089,44 @@ namespace hpx { namespace util
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::init_use_huge_pages() const
+    {
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                return hpx::util::get_entry_as<int>(
+                    *sec, "use_huge_pages", "0") != 0;
+            }
+        }
+        return false;    // default is false
+    }
+#endif
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+    void runtime_configuration::init_stack_pool() const
+    {
+        namespace posix = threads::coroutines::detail::posix;
+
+        posix::stack_pool_high_watermark = 0;
+        posix::stack_pool_low_watermark = 0;
+        posix::use_madv_free = false;
+
+        if (has_section("hpx")) {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec) {
+                posix::stack_pool_high_watermark =
+                    hpx::util::get_entry_as<std::size_t>(
+                        *sec, "pool_high_watermark", "0");
+                posix::stack_pool_low_watermark = (std::min)(
+                    posix::stack_pool_high_watermark,
+                    hpx::util::get_entry_as<std::size_t>(
+                        *sec, "pool_low_watermark", "64"));
+                posix::use_madv_free = hpx::util::get_entry_as<int>(
+                    *sec, "use_madv_free", "0") != 0;
+            }
+        }
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
@@ -1147,6 +1220,15 @@ namespace hpx { namespace util
         case threads::thread_stacksize_huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize_nostack:
+#if defined(HPX_HAVE_STACKLESS_COROUTINES)
+            return (std::numeric_limits<std::ptrdiff_t>::max)();
+#else
+            // the context switching implementation allocates the stack
+            // eagerly, stackless threads get a small stack instead
+            break;
+#endif
+
         default:
         case threads::thread_stacksize_small:
             break;
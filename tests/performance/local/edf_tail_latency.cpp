@@ -0,0 +1,144 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the latency of short (interactive) tasks carrying a
+// deadline while the system is busy executing longer running (batch) tasks
+// without a deadline. Run it with --hpx:queuing=edf and compare the results
+// with the ones for the default scheduler.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/util/format.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "worker_timed.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t batch_tasks = 10000;
+std::size_t interactive_tasks = 1000;
+std::uint64_t batch_delay = 100;
+std::uint64_t interactive_delay = 1;
+std::uint64_t deadline = 100;
+
+void batch_work()
+{
+    worker_timed(batch_delay * 1000);
+}
+
+// returns the time between launching the task and it having been finished
+std::uint64_t interactive_work(std::uint64_t launched)
+{
+    worker_timed(interactive_delay * 1000);
+    return hpx::util::high_resolution_clock::now() - launched;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double percentile(std::vector<std::uint64_t> const& sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+
+    std::size_t index = static_cast<std::size_t>(p * (sorted.size() - 1));
+    return sorted[index] / 1e3;
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    bool print_header = vm.count("no-header") == 0;
+
+    hpx::parallel::execution::deadline_executor exec{
+        std::chrono::microseconds(deadline)};
+
+    // flood the system with batch work
+    std::vector<hpx::future<void>> batch;
+    batch.reserve(batch_tasks);
+    for (std::size_t i = 0; i != batch_tasks; ++i)
+    {
+        batch.push_back(hpx::async(&batch_work));
+    }
+
+    // interleave interactive work carrying a deadline
+    std::vector<hpx::future<std::uint64_t>> interactive;
+    interactive.reserve(interactive_tasks);
+
+    std::size_t const stride =
+        (std::max)(std::size_t(1), batch_tasks / interactive_tasks);
+    for (std::size_t i = 0; i != interactive_tasks; ++i)
+    {
+        interactive.push_back(hpx::async(exec, &interactive_work,
+            hpx::util::high_resolution_clock::now()));
+
+        // give the batch work a chance to make progress
+        worker_timed(stride * batch_delay * 1000 / hpx::get_os_thread_count());
+    }
+
+    std::vector<std::uint64_t> latencies = hpx::util::unwrap(interactive);
+    hpx::wait_all(batch);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    if (print_header)
+    {
+        hpx::cout
+            << "num_cores,batch_tasks,interactive_tasks,"
+               "p50[us],p99[us],p999[us],max[us]"
+            << hpx::endl;
+    }
+
+    hpx::util::format_to(hpx::cout,
+        "{},{},{},{},{},{},{}",
+        hpx::get_os_thread_count(),
+        batch_tasks,
+        interactive_tasks,
+        percentile(latencies, 0.5),
+        percentile(latencies, 0.99),
+        percentile(latencies, 0.999),
+        percentile(latencies, 1.0)) << hpx::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    namespace po = boost::program_options;
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("batch-tasks",
+            po::value<std::size_t>(&batch_tasks)->default_value(10000),
+            "number of batch tasks to create (default: 10000)")
+        ("interactive-tasks",
+            po::value<std::size_t>(&interactive_tasks)->default_value(1000),
+            "number of interactive tasks to create (default: 1000)")
+        ("batch-delay",
+            po::value<std::uint64_t>(&batch_delay)->default_value(100),
+            "time to busy wait in each batch task [microseconds] "
+            "(default: 100)")
+        ("interactive-delay",
+            po::value<std::uint64_t>(&interactive_delay)->default_value(1),
+            "time to busy wait in each interactive task [microseconds] "
+            "(default: 1)")
+        ("deadline",
+            po::value<std::uint64_t>(&deadline)->default_value(100),
+            "relative deadline of the interactive tasks [microseconds] "
+            "(default: 100)")
+        ("no-header", "do not print out the csv header row")
+        ;
+
+    return hpx::init(cmdline, argc, argv);
+}
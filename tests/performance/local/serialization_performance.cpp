@@ -4,14 +4,17 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/runtime/serialization/deque.hpp>
 #include <hpx/runtime/serialization/serialize.hpp>
 #include <hpx/runtime/serialization/string.hpp>
 #include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 #include <hpx/version.hpp>
 
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -217,6 +220,92 @@ void hpx_serialization_test(std::size_t iterations)
               << std::endl << std::endl;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Compare the bitwise (bulk) serialization of trivially copyable elements with
+// the member by member serialization of the same data
+std::size_t const kPointsCount = 10000;
+
+namespace hpx_test
+{
+    // marked to be bitwise serializable
+    struct Point
+    {
+        double x, y, z;
+        std::int64_t id;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int)
+        {
+            ar & x & y & z & id;
+        }
+    };
+
+    // serialized member by member
+    struct PointPerMember
+    {
+        double x, y, z;
+        std::int64_t id;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int)
+        {
+            ar & x & y & z & id;
+        }
+    };
+
+}
+
+HPX_IS_BITWISE_SERIALIZABLE(hpx_test::Point)
+
+static_assert(hpx::traits::is_bitwise_serializable<hpx_test::Point>::value,
+    "Point should be bitwise serializable");
+static_assert(
+    !hpx::traits::is_bitwise_serializable<hpx_test::PointPerMember>::value,
+    "PointPerMember should not be bitwise serializable");
+
+template <typename Container>
+void points_serialization_test(
+    char const* name, std::size_t iterations)
+{
+    typedef typename Container::value_type point_type;
+
+    Container points1, points2;
+    for (std::size_t i = 0; i != kPointsCount; ++i)
+    {
+        double d = static_cast<double>(i);
+        points1.push_back(point_type{d, 2 * d, 3 * d, std::int64_t(i)});
+    }
+
+    std::vector<char> serialized;
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        serialized.clear();
+        {
+            hpx::serialization::output_archive archiver(serialized);
+            archiver << points1;
+        }
+        {
+            hpx::serialization::input_archive archiver(serialized);
+            archiver >> points2;
+        }
+    }
+
+    auto finish = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        finish - start).count();
+
+    if (points2.size() != kPointsCount ||
+        points2.back().id != std::int64_t(kPointsCount - 1))
+    {
+        throw std::logic_error("points: deserialization failed");
+    }
+
+    std::cout << name << ": size = " << serialized.size() << " bytes, time = "
+              << duration << " milliseconds" << std::endl;
+}
+
 int main(int argc, char **argv)
 {
     if (argc < 2)
@@ -239,5 +328,17 @@ int main(int argc, char **argv)
     }
 
     hpx_serialization_test(iterations);
+
+    using hpx_test::Point;
+    using hpx_test::PointPerMember;
+
+    points_serialization_test<std::vector<Point> >(
+        "vector, bitwise   ", iterations);
+    points_serialization_test<std::vector<PointPerMember> >(
+        "vector, per member", iterations);
+    points_serialization_test<std::deque<Point> >(
+        "deque, bitwise    ", iterations);
+    points_serialization_test<std::deque<PointPerMember> >(
+        "deque, per member ", iterations);
 }
 
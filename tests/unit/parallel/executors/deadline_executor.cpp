@@ -0,0 +1,138 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/runtime/threads/policies/edf_queue_backend.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t get_self_deadline()
+{
+    return hpx::threads::get_self_id()->get_deadline();
+}
+
+void test_async()
+{
+    typedef hpx::parallel::execution::deadline_executor executor;
+
+    executor exec(std::chrono::milliseconds(10));
+
+    std::uint64_t before = hpx::util::high_resolution_clock::now();
+    std::uint64_t deadline =
+        hpx::parallel::execution::async_execute(exec, &get_self_deadline).get();
+    std::uint64_t after = hpx::util::high_resolution_clock::now();
+
+    HPX_TEST_LTE(before + 10000000, deadline);
+    HPX_TEST_LTE(deadline, after + 10000000);
+}
+
+void test_sync()
+{
+    typedef hpx::parallel::execution::deadline_executor executor;
+
+    executor exec(std::chrono::milliseconds(10));
+    HPX_TEST(hpx::parallel::execution::sync_execute(exec, &get_self_deadline) !=
+        hpx::threads::no_deadline);
+}
+
+void test_post()
+{
+    typedef hpx::parallel::execution::deadline_executor executor;
+
+    hpx::lcos::local::promise<std::uint64_t> p;
+    hpx::future<std::uint64_t> f = p.get_future();
+
+    executor exec(std::chrono::milliseconds(10));
+    hpx::parallel::execution::post(exec,
+        [&p]() { p.set_value(get_self_deadline()); });
+
+    HPX_TEST(f.get() != hpx::threads::no_deadline);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_edf_ordering()
+{
+    typedef hpx::util::tuple<hpx::threads::thread_init_data, std::size_t>
+        item_type;
+    typedef hpx::threads::policies::edf_queue_backend<item_type*> queue_type;
+
+    std::vector<item_type> items(8);
+    std::uint64_t const deadlines[] = {
+        50, hpx::threads::no_deadline, 10, 40, hpx::threads::no_deadline,
+        20, 30, 10
+    };
+    for (std::size_t i = 0; i != items.size(); ++i)
+    {
+        hpx::util::get<0>(items[i]).deadline = deadlines[i];
+        hpx::util::get<1>(items[i]) = i;
+    }
+
+    queue_type q;
+    for (item_type& item : items)
+        q.push(&item);
+
+    // earliest deadline first, FIFO for equal deadlines
+    std::size_t const expected[] = { 2, 7, 5, 6, 3, 0, 1, 4 };
+    for (std::size_t i : expected)
+    {
+        item_type* item = nullptr;
+        HPX_TEST(q.pop(item, i % 2 == 0));
+        HPX_TEST_EQ(hpx::util::get<1>(*item), i);
+    }
+    HPX_TEST(q.empty());
+
+    // items pushed to the other end are queued behind all items which are
+    // currently queued and have a deadline
+    q.push(&items[2]);
+    q.push(&items[3]);
+    q.push(&items[7], true);
+    q.push(&items[5]);
+
+    std::size_t const expected_other_end[] = { 2, 5, 3, 7 };
+    for (std::size_t i : expected_other_end)
+    {
+        item_type* item = nullptr;
+        HPX_TEST(q.pop(item));
+        HPX_TEST_EQ(hpx::util::get<1>(*item), i);
+    }
+    HPX_TEST(q.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_async();
+    test_sync();
+    test_post();
+    test_edf_ordering();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores and should use
+    // the scheduler supporting deadlines
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all",
+        "hpx.scheduler=edf"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::thread::id test(int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    return hpx::this_thread::get_id();
+}
+
+void test_sync()
+{
+    typedef hpx::parallel::execution::work_first_executor executor;
+
+    executor exec;
+    HPX_TEST(hpx::parallel::execution::sync_execute(exec, &test, 42) ==
+        hpx::this_thread::get_id());
+}
+
+void test_async_inline()
+{
+    typedef hpx::parallel::execution::work_first_executor executor;
+
+    // always execute inline as long as there is enough stack space
+    executor exec(0);
+    HPX_TEST(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get() ==
+        hpx::this_thread::get_id());
+}
+
+void test_async_fork()
+{
+    typedef hpx::parallel::execution::work_first_executor executor;
+
+    // never execute inline
+    executor exec((std::numeric_limits<std::int64_t>::max)());
+    HPX_TEST(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get() !=
+        hpx::this_thread::get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_post()
+{
+    typedef hpx::parallel::execution::work_first_executor executor;
+
+    hpx::lcos::local::promise<hpx::thread::id> p;
+    hpx::future<hpx::thread::id> f = p.get_future();
+
+    executor exec;
+    hpx::parallel::execution::post(exec,
+        [&p]() { p.set_value(hpx::this_thread::get_id()); });
+
+    HPX_TEST(f.get() != hpx::this_thread::get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fibonacci(
+    hpx::parallel::execution::work_first_executor const& exec, std::uint64_t n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> lhs =
+        hpx::async(exec, &fibonacci, std::ref(exec), n - 1);
+    std::uint64_t rhs = fibonacci(exec, n - 2);
+
+    return lhs.get() + rhs;
+}
+
+void test_recursive()
+{
+    typedef hpx::parallel::execution::work_first_executor executor;
+
+    executor exec;
+    HPX_TEST_EQ(fibonacci(exec, 20), std::uint64_t(6765));
+
+    executor exec_inline(0);
+    HPX_TEST_EQ(fibonacci(exec_inline, 20), std::uint64_t(6765));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_sync();
+    test_async_inline();
+    test_async_fork();
+    test_post();
+    test_recursive();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests the codec selection of the adaptive compression of parcelports,
+// codecs are never chosen for messages larger than they can compress.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/runtime/parcelset/detail/adaptive_compression.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/runtime_configuration.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::detail::adaptive_compression;
+
+// the codecs as configured below
+int const lz4 = 0;
+int const snappy = 1;
+int const zlib = 2;
+
+std::size_t const threshold = 1024;
+
+// the link has been measured, sending uncompressed data is cheap
+void measure_link(adaptive_compression& ac)
+{
+    ac.add_sent_data(10 * threshold, 1000);
+    ac.add_encoded_data(-1, 10 * threshold, 10 * threshold, 10);
+}
+
+void test_disabled()
+{
+    adaptive_compression ac(hpx::get_config(), "disabled");
+    HPX_TEST(!ac.enabled());
+
+    measure_link(ac);
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), -1);
+}
+
+void test_selection()
+{
+    adaptive_compression ac(hpx::get_config(), "adaptive");
+    HPX_TEST(ac.enabled());
+
+    // small messages and messages sent before the link has been measured
+    // are not compressed
+    HPX_TEST_EQ(ac.select_codec(threshold - 1), -1);
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), -1);
+
+    measure_link(ac);
+    HPX_TEST_EQ(ac.select_codec(threshold - 1), -1);
+
+    // every codec is tried once
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), lz4);
+    ac.add_encoded_data(lz4, 10 * threshold, threshold, 100);
+
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), snappy);
+    ac.add_encoded_data(snappy, 10 * threshold, 2 * threshold, 100);
+
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), zlib);
+    ac.add_encoded_data(zlib, 10 * threshold, 3 * threshold, 1000);
+
+    HPX_TEST_EQ(ac.get_compressed_messages(false), 3);
+    HPX_TEST_EQ(ac.get_compressed_raw_bytes(false),
+        std::int64_t(30 * threshold));
+    HPX_TEST_EQ(ac.get_compressed_bytes(true), std::int64_t(6 * threshold));
+    HPX_TEST_EQ(ac.get_compressed_bytes(false), 0);
+
+    // LZ4 is never chosen for messages it can't compress, even while probing
+    // the alternatives
+    std::size_t const too_large_for_lz4 = std::size_t(0x7E000000) + 1;
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(ac.select_codec(too_large_for_lz4) != lz4);
+    }
+
+    // neither is snappy for messages larger than 4GB
+    if (sizeof(std::size_t) > 4)
+    {
+        std::size_t const too_large_for_snappy =
+            std::size_t(0xFFFFFFFF) + 1;
+        for (int i = 0; i != 100; ++i)
+        {
+            int codec = ac.select_codec(too_large_for_snappy);
+            HPX_TEST(codec != lz4 && codec != snappy);
+        }
+    }
+}
+
+void test_untried_large_messages()
+{
+    adaptive_compression ac(hpx::get_config(), "adaptive");
+    measure_link(ac);
+
+    // a codec is not tried using a message it can't compress
+    HPX_TEST_EQ(ac.select_codec(std::size_t(0x7E000000) + 1), snappy);
+    HPX_TEST_EQ(ac.select_codec(10 * threshold), lz4);
+}
+
+int hpx_main()
+{
+    test_disabled();
+    test_selection();
+    test_untried_large_messages();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.adaptive.adaptive_compression=1",
+        "hpx.parcel.adaptive.adaptive_compression_threshold=" +
+            std::to_string(threshold),
+        "hpx.parcel.adaptive_compression_codecs=lz4,snappy,zlib"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
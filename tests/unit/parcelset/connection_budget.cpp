@@ -0,0 +1,100 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that the connections used for the priority lane are taken from
+// the configured maximal number of connections of a parcelport and that
+// parcels of both lanes are delivered if only few connections are allowed.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using hpx::parcelset::parcelport;
+
+///////////////////////////////////////////////////////////////////////////////
+int normal(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(normal, normal_action);
+
+int urgent(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(urgent, urgent_action);
+HPX_ACTION_HAS_HIGH_PRIORITY(urgent_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_budget()
+{
+    // without priority lanes all connections are used for normal parcels
+    HPX_TEST_EQ(parcelport::get_max_priority_connections(512, false),
+        std::size_t(0));
+
+    // an eighth of the connections is reserved for the priority lane
+    HPX_TEST_EQ(parcelport::get_max_priority_connections(512, true),
+        std::size_t(64));
+
+    // connection caches hold at least two connections
+    HPX_TEST_EQ(parcelport::get_max_priority_connections(8, true),
+        std::size_t(2));
+    HPX_TEST_EQ(parcelport::get_max_priority_connections(0, true),
+        std::size_t(2));
+}
+
+void test_delivery()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+
+    std::vector<hpx::future<int> > normal_futures;
+    std::vector<hpx::future<int> > urgent_futures;
+    for (hpx::id_type const& id : localities)
+    {
+        for (int i = 0; i != 1000; ++i)
+        {
+            normal_futures.push_back(hpx::async(normal_action(), id, i));
+            urgent_futures.push_back(hpx::async(urgent_action(), id, i));
+        }
+    }
+
+    for (std::size_t i = 0; i != normal_futures.size(); ++i)
+    {
+        HPX_TEST_EQ(normal_futures[i].get(), static_cast<int>(i % 1000));
+        HPX_TEST_EQ(urgent_futures[i].get(), static_cast<int>(i % 1000));
+    }
+}
+
+int hpx_main()
+{
+    test_budget();
+    test_delivery();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // allow for only a few connections, two of them are used for the
+    // priority lane
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.priority_lanes=1",
+        "hpx.parcel.tcp.max_connections=6",
+        "hpx.parcel.tcp.max_connections_per_locality=2",
+        "hpx.parcel.mpi.max_connections=6",
+        "hpx.parcel.mpi.max_connections_per_locality=2"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
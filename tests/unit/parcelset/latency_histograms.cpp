@@ -0,0 +1,204 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests the latency histograms of the parcel layer: the samples are
+// sorted into the correct buckets of the matching histograms only, also if
+// they are added concurrently, and the histogram counters collect data for
+// parcels sent to other localities.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/parcelset/detail/latency_histograms.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using hpx::parcelset::detail::latency_histograms;
+
+///////////////////////////////////////////////////////////////////////////////
+int echo(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(echo, echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t const all_localities = hpx::naming::invalid_locality_id;
+
+std::int64_t sum_buckets(std::vector<std::int64_t> const& values)
+{
+    HPX_TEST(values.size() > 3);
+    return std::accumulate(values.begin() + 3, values.end(), std::int64_t(0));
+}
+
+void test_buckets()
+{
+    latency_histograms h;
+    HPX_TEST(!h.enabled(hpx::parcelset::detail::latency_serialization));
+
+    auto f = h.get_histogram_counter(
+        hpx::parcelset::detail::latency_serialization, "", all_localities,
+        0, 1000, 10);
+    HPX_TEST(h.enabled(hpx::parcelset::detail::latency_serialization));
+    HPX_TEST(!h.enabled(hpx::parcelset::detail::latency_wire));
+
+    // an empty histogram reports zero for all buckets
+    std::vector<std::int64_t> values = f(false);
+    HPX_TEST_EQ(values.size(), std::size_t(3 + 12));
+    HPX_TEST_EQ(values[0], 0);
+    HPX_TEST_EQ(values[1], 1000);
+    HPX_TEST_EQ(values[2], 10);
+    HPX_TEST_EQ(sum_buckets(values), 0);
+
+    // underflow, first, last, and overflow bucket
+    h.add_data(hpx::parcelset::detail::latency_serialization, "a", 0, -5);
+    h.add_data(hpx::parcelset::detail::latency_serialization, "a", 0, 0);
+    h.add_data(hpx::parcelset::detail::latency_serialization, "a", 0, 999);
+    h.add_data(hpx::parcelset::detail::latency_serialization, "a", 0, 1000);
+
+    // other stages are not affected
+    h.add_data(hpx::parcelset::detail::latency_wire, "a", 0, 500);
+
+    values = f(true);
+    std::vector<std::int64_t> expected = {
+        0, 1000, 10, 250, 250, 0, 0, 0, 0, 0, 0, 0, 0, 250, 250};
+    HPX_TEST(values == expected);
+
+    // the histogram was reset
+    HPX_TEST_EQ(sum_buckets(f(false)), 0);
+}
+
+void test_filters()
+{
+    latency_histograms h;
+    hpx::parcelset::detail::latency_stage const stage =
+        hpx::parcelset::detail::latency_enqueue_to_send;
+
+    auto all = h.get_histogram_counter(stage, "", all_localities, 0, 100, 1);
+    auto action = h.get_histogram_counter(stage, "a", all_localities, 0, 100, 1);
+    auto locality = h.get_histogram_counter(stage, "", 1, 0, 100, 1);
+
+    // requesting a histogram with the same parameters reuses it
+    auto action2 =
+        h.get_histogram_counter(stage, "a", all_localities, 0, 100, 1);
+
+    h.add_data(stage, "a", 0, 50);
+    h.add_data(stage, "b", 1, 50);
+    h.add_data(stage, nullptr, 1, 50);
+
+    std::vector<std::int64_t> expected_all = {0, 100, 1, 0, 1000, 0};
+    std::vector<std::int64_t> expected_none = {0, 100, 1, 0, 0, 0};
+
+    HPX_TEST(all(false) == expected_all);
+    HPX_TEST(action(false) == expected_all);
+    HPX_TEST(locality(false) == expected_all);
+
+    // only the parcels of action 'a' were accounted for
+    action2(true);
+    HPX_TEST(action(false) == expected_none);
+    HPX_TEST(all(false) == expected_all);
+}
+
+void test_concurrent_add_data()
+{
+    latency_histograms h;
+    hpx::parcelset::detail::latency_stage const stage =
+        hpx::parcelset::detail::latency_receive_to_schedule;
+
+    auto f = h.get_histogram_counter(stage, "", all_localities, 0, 100, 2);
+
+    // histograms are created while data is being added
+    std::vector<std::thread> threads;
+    for (int i = 0; i != 4; ++i)
+    {
+        threads.emplace_back([&h, stage]() {
+            for (int j = 0; j != 10000; ++j)
+            {
+                h.add_data(stage, "a", 0, (j % 2) ? 25 : 75);
+            }
+        });
+    }
+
+    for (std::int64_t i = 0; i != 10; ++i)
+    {
+        h.get_histogram_counter(stage, "a", all_localities, 0, 100, i + 1);
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+
+    std::vector<std::int64_t> expected = {0, 100, 2, 0, 500, 500, 0};
+    HPX_TEST(f(false) == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_counters()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+        return;
+
+    std::vector<hpx::performance_counters::performance_counter> counters;
+    for (char const* pp : {"tcp", "mpi"})
+    {
+        std::string const enable = std::string("hpx.parcel.") + pp + ".enable";
+        if (hpx::get_config_entry(enable, "0") != "1")
+            continue;
+
+        counters.emplace_back("/parcelport{locality#0/total}/histogram/" +
+            std::string(pp) + "/serialization@,0,1000000000,10");
+        counters.back().get_counter_values_array(hpx::launch::sync, true);
+    }
+
+    std::vector<hpx::future<int> > futures;
+    for (hpx::id_type const& id : localities)
+    {
+        for (int i = 0; i != 100; ++i)
+        {
+            futures.push_back(hpx::async(echo_action(), id, i));
+        }
+    }
+    hpx::wait_all(futures);
+
+    // the samples are accounted for by at least one of the parcelports
+    std::int64_t sum = 0;
+    for (hpx::performance_counters::performance_counter& c : counters)
+    {
+        std::vector<std::int64_t> values =
+            c.get_counter_values_array(hpx::launch::sync, false).values_;
+        HPX_TEST_EQ(values.size(), std::size_t(3 + 12));
+
+        std::int64_t buckets = sum_buckets(values);
+        HPX_TEST(buckets == 0 || (buckets > 1000 - 12 && buckets <= 1000));
+        sum += buckets;
+    }
+    HPX_TEST(counters.empty() || sum > 0);
+}
+
+int hpx_main()
+{
+    test_buckets();
+    test_filters();
+    test_concurrent_add_data();
+    test_counters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
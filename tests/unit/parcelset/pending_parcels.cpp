@@ -0,0 +1,109 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that the number of shards of the queues of pending parcels
+// which have parcels waiting to be sent is tracked accurately. No shard is
+// left marked as having pending parcels once all parcels have been sent.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_shards = 4;
+
+int echo(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(echo, echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t sum_counters(std::string const& name)
+{
+    using namespace hpx::performance_counters;
+
+    std::int64_t sum = 0;
+    for (performance_counter const& c : discover_counters(name))
+    {
+        std::int64_t value = c.get_value<std::int64_t>(hpx::launch::sync);
+        HPX_TEST(value >= 0);
+        sum += value;
+    }
+    return sum;
+}
+
+// parcels are sent asynchronously, give the parcelports some time to send
+// the remaining ones
+bool wait_for_empty_queues()
+{
+    for (int i = 0; i != 500; ++i)
+    {
+        if (sum_counters("/parcelport/count/*/pending-shards") == 0 &&
+            sum_counters("/parcelport/count/*/pending-destinations") == 0)
+        {
+            return true;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+
+    for (int round = 0; round != 10; ++round)
+    {
+        std::vector<hpx::future<int> > futures;
+        for (hpx::id_type const& id : localities)
+        {
+            for (int i = 0; i != 1000; ++i)
+            {
+                futures.push_back(hpx::async(echo_action(), id, i));
+            }
+        }
+
+        // a shard is counted at most once, no matter how many parcels are
+        // pending for it
+        for (hpx::performance_counters::performance_counter const& c :
+            hpx::performance_counters::discover_counters(
+                "/parcelport/count/*/pending-shards"))
+        {
+            HPX_TEST(c.get_value<std::int64_t>(hpx::launch::sync) <=
+                std::int64_t(num_shards));
+        }
+
+        for (std::size_t i = 0; i != futures.size(); ++i)
+        {
+            HPX_TEST_EQ(futures[i].get(), static_cast<int>(i % 1000));
+        }
+
+        HPX_TEST(wait_for_empty_queues());
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.pending_queue_shards=" + std::to_string(num_shards)
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
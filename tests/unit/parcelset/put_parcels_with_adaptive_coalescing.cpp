@@ -0,0 +1,124 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests the adaptive mode of the coalescing message handler. Bursts of
+// parcels are coalesced, while parcels arriving further apart than the
+// configured latency ceiling are sent right away, even though the fixed
+// coalescing interval would hold them back much longer.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int echo(int i)
+{
+    return i;
+}
+HPX_DECLARE_PLAIN_ACTION(echo, echo_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(echo_action);
+HPX_PLAIN_ACTION(echo, echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_value(std::string const& name, bool reset = false)
+{
+    hpx::performance_counters::performance_counter c(
+        "/coalescing{locality#0/total}/count/" + name + "@echo_action");
+    return c.get_value<std::int64_t>(hpx::launch::sync, reset);
+}
+
+void reset_counters()
+{
+    get_value("parcels", true);
+    get_value("messages", true);
+}
+
+// many parcels are sent back to back, they are coalesced
+void test_burst(hpx::id_type const& id)
+{
+    reset_counters();
+
+    std::vector<hpx::future<int> > futures;
+    for (int i = 0; i != 1000; ++i)
+    {
+        futures.push_back(hpx::async(echo_action(), id, i));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), static_cast<int>(i));
+    }
+
+    std::int64_t messages = get_value("messages");
+    std::int64_t parcels = get_value("parcels");
+
+    HPX_TEST_EQ(parcels, std::int64_t(futures.size()));
+    HPX_TEST(messages > 0);
+    HPX_TEST(messages < parcels);
+}
+
+// parcels sent further apart than the latency ceiling are never combined
+// into one message
+void test_sparse(hpx::id_type const& id)
+{
+    reset_counters();
+
+    std::vector<hpx::future<int> > futures;
+    for (int i = 0; i != 20; ++i)
+    {
+        futures.push_back(hpx::async(echo_action(), id, i));
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    for (std::size_t i = 0; i != futures.size(); ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), static_cast<int>(i));
+    }
+
+    HPX_TEST_EQ(get_value("parcels"), std::int64_t(futures.size()));
+    HPX_TEST_EQ(get_value("messages"), std::int64_t(futures.size()));
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_burst(id);
+        test_sparse(id);
+
+        // the parameters adapt again once the parcels arrive more quickly
+        test_burst(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the fixed interval (100ms) is much longer than the latency ceiling
+    // (1ms) used in adaptive mode
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=100",
+        "hpx.plugins.coalescing_message_handler.interval=100000",
+        "hpx.plugins.coalescing_message_handler.adaptive=1",
+        "hpx.plugins.coalescing_message_handler.max_latency=1000"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
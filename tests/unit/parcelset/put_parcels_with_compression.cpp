@@ -34,7 +34,7 @@ generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont, T && data
         std::move(dest), std::move(addr),
         hpx::actions::typed_continuation<hpx::id_type>(cont),
         Action(), hpx::threads::thread_priority_normal,
-        std::forward<T>(data));
+        std::forward<T>(data)));
 
     p.set_source_id(hpx::find_here());
     p.size() = 4096;
@@ -68,6 +68,8 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test1_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test1_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test1_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test1_action)
 #endif
 
 HPX_REGISTER_ACTION(test1_action);
@@ -123,6 +125,8 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test2_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test2_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test2_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test2_action)
 #endif
 
 HPX_PLAIN_ACTION(test2, test2_action);
@@ -272,6 +276,24 @@ void verify_counters()
             << ", value: " << data_value.get_value<double>()
             << std::endl;
     }
+
+    // the send buffers are presized using the maximal size of the filtered
+    // data, any reallocations are counted
+    std::vector<performance_counter> reallocated_counters =
+        discover_counters("/parcelport/count/*/send-buffer-reallocated-bytes");
+
+    HPX_TEST(!reallocated_counters.empty());
+
+    for (performance_counter const& counter : reallocated_counters)
+    {
+        counter_value value = counter.get_counter_value(hpx::launch::sync);
+        HPX_TEST(value.get_value<double>() >= 0);
+
+        hpx::cout
+            << "counter: " << counter.get_name(hpx::launch::sync)
+            << ", value: " << value.get_value<double>()
+            << std::endl;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/util/annotated_function.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_tasks = 100;
+
+void yielding_task()
+{
+    hpx::this_thread::yield();
+}
+
+std::int64_t get_counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+int hpx_main()
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(
+            hpx::util::annotated_function(&yielding_task, "yielding_task")));
+    }
+    hpx::wait_all(tasks);
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // each task runs two phases, as it yields once
+    std::int64_t phases = get_counter_value(
+        "/threads{locality#0/total}/count/per-description/phases@"
+        "yielding_task");
+    HPX_TEST_EQ(phases, std::int64_t(2 * num_tasks));
+
+    std::int64_t suspensions = get_counter_value(
+        "/threads{locality#0/total}/count/per-description/suspensions@"
+        "yielding_task");
+    HPX_TEST_EQ(suspensions, std::int64_t(num_tasks));
+
+    std::int64_t exec_time = get_counter_value(
+        "/threads{locality#0/total}/time/per-description@yielding_task");
+    HPX_TEST_LT(std::int64_t(0), exec_time);
+
+    // the overall values include all other threads
+    std::int64_t all_phases = get_counter_value(
+        "/threads{locality#0/total}/count/per-description/phases");
+    HPX_TEST_LTE(phases, all_phases);
+
+    // unknown descriptions are accepted, they have not been executed yet
+    HPX_TEST_EQ(get_counter_value(
+        "/threads{locality#0/total}/count/per-description/phases@"
+        "unknown_task"), std::int64_t(0));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all",
+        "hpx.thread_profiling.enabled=1"
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
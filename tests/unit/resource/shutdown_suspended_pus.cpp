@@ -72,8 +72,11 @@ int main(int argc, char* argv[])
             {
 #if defined(HPX_HAVE_LOCAL_SCHEDULER)
                 hpx::resource::scheduling_policy::local,
+                hpx::resource::scheduling_policy::local_chase_lev,
                 hpx::resource::scheduling_policy::local_priority_fifo,
                 hpx::resource::scheduling_policy::local_priority_lifo,
+                hpx::resource::scheduling_policy::local_priority_chase_lev,
+                hpx::resource::scheduling_policy::edf,
 #endif
 #if defined(HPX_HAVE_ABP_SCHEDULER)
                 hpx::resource::scheduling_policy::abp_priority_fifo,
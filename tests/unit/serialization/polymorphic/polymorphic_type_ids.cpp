@@ -0,0 +1,188 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that intrusively registered polymorphic classes are serialized
+// using their ids if the archive has type ids enabled.
+
+#include <hpx/exception.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/base_object.hpp>
+#include <hpx/runtime/serialization/detail/polymorphic_intrusive_factory.hpp>
+#include <hpx/runtime/serialization/shared_ptr.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using hpx::serialization::detail::polymorphic_intrusive_factory;
+
+struct base
+{
+    base(int b = 1) : b(b) {}
+    virtual ~base() {}
+
+    virtual int value() const = 0;
+
+    int b;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & b;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(base);
+};
+
+struct derived_with_a_long_class_name : base
+{
+    derived_with_a_long_class_name(int b = 1, int d = 2) : base(b), d(d) {}
+
+    int value() const
+    {
+        return b + d;
+    }
+
+    int d;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar & hpx::serialization::base_object<base>(*this);
+        ar & d;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(derived_with_a_long_class_name);
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t test_round_trip(std::uint32_t flags)
+{
+    std::shared_ptr<base> op = std::make_shared<derived_with_a_long_class_name>(
+        3, 4);
+
+    std::vector<char> buffer;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << op;
+        size = oarchive.bytes_written();
+    }
+
+    std::shared_ptr<base> ip;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> ip;
+    }
+
+    HPX_TEST(ip);
+    HPX_TEST(dynamic_cast<derived_with_a_long_class_name*>(ip.get()));
+    HPX_TEST_EQ(ip->value(), 7);
+
+    return size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A class registered after the ids have been exchanged (e.g. by a
+// dynamically loaded module)
+int late_registered_object = 42;
+
+void* create_late_registered()
+{
+    return &late_registered_object;
+}
+
+void test_late_registered()
+{
+    polymorphic_intrusive_factory& factory =
+        polymorphic_intrusive_factory::instance();
+
+    // locality 0 knew about the class and has assigned an id to it
+    std::string const name = "late_registered_class";
+    std::uint32_t const id = factory.get_max_registered_id() + 1;
+    factory.register_typename(name, id);
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, hpx::serialization::enable_type_ids);
+        factory.save_name(oarchive, name);
+    }
+
+    // the class is unknown as long as it is not registered
+    {
+        bool caught_exception = false;
+        try {
+            hpx::serialization::input_archive iarchive(buffer);
+            factory.create(iarchive);
+        }
+        catch (hpx::exception const&) {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // registering the class late makes it available using the id
+    factory.register_class(name, &create_late_registered);
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        HPX_TEST_EQ(factory.create(iarchive),
+            static_cast<void*>(&late_registered_object));
+    }
+}
+
+// a class without an id is sent by name
+int unassigned_object = 43;
+
+void* create_unassigned()
+{
+    return &unassigned_object;
+}
+
+void test_unassigned()
+{
+    polymorphic_intrusive_factory& factory =
+        polymorphic_intrusive_factory::instance();
+
+    std::string const name = "class_without_an_id";
+    factory.register_class(name, &create_unassigned);
+    HPX_TEST_EQ(factory.try_get_id(name),
+        std::uint32_t(polymorphic_intrusive_factory::invalid_id));
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, hpx::serialization::enable_type_ids);
+        factory.save_name(oarchive, name);
+    }
+
+    hpx::serialization::input_archive iarchive(buffer);
+    HPX_TEST_EQ(factory.create(iarchive),
+        static_cast<void*>(&unassigned_object));
+}
+
+int main()
+{
+    // no ids have been assigned yet, the names are sent in any case
+    std::size_t size_names = test_round_trip(0);
+    HPX_TEST_EQ(test_round_trip(hpx::serialization::enable_type_ids),
+        size_names + sizeof(std::uint32_t));
+
+    // assign the ids the way locality 0 does during startup
+    polymorphic_intrusive_factory::instance().fill_missing_typenames();
+
+    HPX_TEST_EQ(test_round_trip(0), size_names);
+    HPX_TEST(test_round_trip(hpx::serialization::enable_type_ids) <
+        size_names);
+
+    test_late_registered();
+    test_unassigned();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,181 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that archives using a binary filter produce buffers holding
+// exactly the filtered data and that they can be read back.
+
+#include <hpx/exception.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/runtime/serialization/binary_filter.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// A filter which passes the data through unchanged. It optionally reports the
+// maximal length of the flushed data.
+struct identity_filter : hpx::serialization::binary_filter
+{
+    explicit identity_filter(bool report_max_length = false)
+      : report_max_length_(report_max_length), current_(0)
+    {}
+
+    void set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    void save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin + src_count,
+            std::back_inserter(buffer_));
+    }
+
+    bool flush(void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (dst_count < buffer_.size())
+        {
+            written = 0;
+            return false;
+        }
+
+        if (!buffer_.empty())
+            std::memcpy(dst, buffer_.data(), buffer_.size());
+        written = buffer_.size();
+        return true;
+    }
+
+    std::size_t get_max_flush_length(std::size_t size) const
+    {
+        return report_max_length_ ? size : 0;
+    }
+
+    std::size_t init_data(char const* buffer, std::size_t size,
+        std::size_t buffer_size)
+    {
+        HPX_TEST_EQ(size, buffer_size);
+        buffer_.assign(buffer, buffer + size);
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    void load(void* dst, std::size_t dst_count)
+    {
+        HPX_TEST(current_ + dst_count <= buffer_.size());
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned) {}
+
+    HPX_SERIALIZATION_POLYMORPHIC(identity_filter);
+
+    bool report_max_length_;
+    std::vector<char> buffer_;
+    std::size_t current_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// A filter which is never able to flush its data, no matter how much room it
+// is given.
+struct failing_filter : identity_filter
+{
+    explicit failing_filter(bool report_max_length)
+      : identity_filter(report_max_length)
+    {}
+
+    bool flush(void*, std::size_t, std::size_t& written)
+    {
+        written = 0;
+        return false;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_filtered_buffer(bool report_max_length, bool reserve)
+{
+    std::vector<int> data(10000);
+    std::iota(data.begin(), data.end(), 0);
+
+    identity_filter filter(report_max_length);
+
+    std::vector<char> buffer;
+    if (reserve)
+        buffer.reserve(2 * data.size() * sizeof(int));
+
+    std::size_t bytes_written = 0;
+    std::size_t bytes_reallocated = 0;
+    {
+        hpx::serialization::output_archive oarchive(buffer,
+            hpx::serialization::enable_compression, nullptr, &filter);
+        oarchive << data;
+        oarchive.flush();
+
+        bytes_written = oarchive.bytes_written();
+        bytes_reallocated = oarchive.bytes_reallocated();
+    }
+
+    // the buffer holds the uncompressed header and the filtered data, it
+    // is truncated to that size instead of being grown
+    HPX_TEST_EQ(buffer.size(), bytes_written);
+
+    // knowing the size of the filtered data avoids growing the buffer
+    // while flushing
+    if (reserve && report_max_length)
+    {
+        HPX_TEST_EQ(bytes_reallocated, std::size_t(0));
+    }
+
+    std::vector<int> restored;
+    {
+        hpx::serialization::input_archive iarchive(buffer, bytes_written);
+        iarchive >> restored;
+    }
+    HPX_TEST(data == restored);
+}
+
+// flushing fails instead of growing the buffer forever if growing it does
+// not help
+void test_failing_filter()
+{
+    std::vector<int> data(10000);
+    std::iota(data.begin(), data.end(), 0);
+
+    failing_filter filter(true);
+
+    std::vector<char> buffer;
+    bool caught_exception = false;
+    try {
+        hpx::serialization::output_archive oarchive(buffer,
+            hpx::serialization::enable_compression, nullptr, &filter);
+        oarchive << data;
+        oarchive.flush();
+    }
+    catch (hpx::exception const& e) {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_filtered_buffer(false, false);
+    test_filtered_buffer(false, true);
+    test_filtered_buffer(true, false);
+    test_filtered_buffer(true, true);
+
+    test_failing_filter();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,244 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <boost/predef/other/endian.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// trivially copyable, serialized member by member by serialize_struct (if
+// supported)
+struct plain
+{
+    int a;
+    double b;
+};
+
+// trivially copyable without any other way of being serialized, inferred to
+// be bitwise serializable
+class opaque
+{
+public:
+    opaque() = default;
+    opaque(std::int32_t a, double b)
+      : a_(a), b_(b)
+    {}
+
+    std::int32_t a() const { return a_; }
+    double b() const { return b_; }
+
+private:
+    std::int32_t a_;
+    double b_;
+};
+
+// opted out of being inferred to be bitwise serializable
+class opted_out
+{
+public:
+    opted_out() = default;
+
+private:
+    int* p_;
+};
+
+HPX_IS_NOT_BITWISE_SERIALIZABLE(opted_out)
+
+struct with_pointer
+{
+    int* p;
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+// marked as being bitwise serializable, counts how often it is serialized
+// member by member
+struct point
+{
+    static std::size_t serialize_count;
+
+    std::int32_t x;
+    double y;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ++serialize_count;
+        ar & x & y;
+    }
+};
+
+std::size_t point::serialize_count = 0;
+
+HPX_IS_BITWISE_SERIALIZABLE(point)
+
+///////////////////////////////////////////////////////////////////////////////
+// classes which can be serialized member by member are bitwise serializable
+// only if they are marked as such
+static_assert(hpx::traits::is_bitwise_serializable<int>::value,
+    "int should be bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<double>::value,
+    "double should be bitwise serializable");
+#if defined(HPX_HAVE_CXX17_STRUCTURED_BINDINGS) && \
+    defined(HPX_HAVE_CXX17_IF_CONSTEXPR)
+static_assert(!hpx::traits::is_bitwise_serializable<plain>::value,
+    "plain should not be bitwise serializable");
+#endif
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+static_assert(hpx::traits::is_bitwise_serializable<opaque>::value,
+    "opaque should be bitwise serializable");
+#endif
+static_assert(!hpx::traits::is_bitwise_serializable<opted_out>::value,
+    "opted_out should not be bitwise serializable");
+static_assert(!hpx::traits::is_bitwise_serializable<with_pointer>::value,
+    "with_pointer should not be bitwise serializable");
+static_assert(hpx::traits::is_bitwise_serializable<point>::value,
+    "point should be bitwise serializable");
+
+static_assert(
+    hpx::traits::is_bitwise_serializable<std::pair<int, point> >::value,
+    "pair<int, point> should be bitwise serializable");
+static_assert(
+    !hpx::traits::is_bitwise_serializable<std::pair<int, opted_out> >::value,
+    "pair<int, opted_out> should not be bitwise serializable");
+static_assert(
+    hpx::traits::is_bitwise_serializable<std::array<point, 4> >::value,
+    "array<point, 4> should be bitwise serializable");
+static_assert(
+    hpx::traits::is_bitwise_serializable<
+        hpx::util::tuple<int, double, point> >::value,
+    "tuple<int, double, point> should be bitwise serializable");
+static_assert(
+    !hpx::traits::is_bitwise_serializable<
+        hpx::util::tuple<int, with_pointer> >::value,
+    "tuple<int, with_pointer> should not be bitwise serializable");
+
+///////////////////////////////////////////////////////////////////////////////
+void test_points(std::uint32_t flags, bool expect_serialize)
+{
+    std::vector<point> os;
+    for (std::int32_t i = 0; i != 100; ++i)
+    {
+        os.push_back(point{i, i / 2.});
+    }
+
+    point::serialize_count = 0;
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << os << os.front();
+    }
+
+    // the types are serialized using their serialize function if array
+    // optimizations are disabled or if the endianess of the archive differs
+    if (expect_serialize)
+    {
+        HPX_TEST_EQ(point::serialize_count, os.size() + 1);
+    }
+    else
+    {
+        HPX_TEST_EQ(point::serialize_count, std::size_t(0));
+    }
+
+    point::serialize_count = 0;
+
+    std::vector<point> is;
+    point front{0, 0.};
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> is >> front;
+    }
+
+    if (expect_serialize)
+    {
+        HPX_TEST_EQ(point::serialize_count, os.size() + 1);
+    }
+    else
+    {
+        HPX_TEST_EQ(point::serialize_count, std::size_t(0));
+    }
+
+    HPX_TEST_EQ(os.size(), is.size());
+    for (std::size_t i = 0; i != os.size(); ++i)
+    {
+        HPX_TEST_EQ(os[i].x, is[i].x);
+        HPX_TEST_EQ(os[i].y, is[i].y);
+    }
+    HPX_TEST_EQ(os.front().x, front.x);
+    HPX_TEST_EQ(os.front().y, front.y);
+}
+
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+// inferred types are always copied as a whole
+void test_opaque(std::uint32_t flags)
+{
+    std::vector<opaque> os;
+    for (std::int32_t i = 0; i != 100; ++i)
+    {
+        os.push_back(opaque(i, i / 2.));
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << os << os.front();
+    }
+
+    std::vector<opaque> is;
+    opaque front(0, 0.);
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> is >> front;
+    }
+
+    HPX_TEST_EQ(os.size(), is.size());
+    for (std::size_t i = 0; i != os.size(); ++i)
+    {
+        HPX_TEST_EQ(os[i].a(), is[i].a());
+        HPX_TEST_EQ(os[i].b(), is[i].b());
+    }
+    HPX_TEST_EQ(os.front().a(), front.a());
+    HPX_TEST_EQ(os.front().b(), front.b());
+}
+#endif
+
+int main()
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    std::uint32_t const other_endianess = hpx::serialization::endian_little;
+#else
+    std::uint32_t const other_endianess = hpx::serialization::endian_big;
+#endif
+
+    test_points(0U, false);
+    test_points(hpx::serialization::disable_array_optimization, true);
+    test_points(other_endianess, true);
+
+#if defined(HPX_HAVE_CXX11_STD_IS_TRIVIALLY_COPYABLE)
+    test_opaque(0U);
+    test_opaque(hpx::serialization::disable_array_optimization);
+#endif
+
+    return hpx::util::report_errors();
+}
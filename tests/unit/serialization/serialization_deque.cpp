@@ -9,6 +9,7 @@
 
 #include <hpx/runtime/serialization/input_archive.hpp>
 #include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
 
 #include <hpx/util/lightweight_test.hpp>
 
@@ -235,6 +236,51 @@ void test_non_default_constructible()
     }
 }
 
+// trivially copyable, marked to be serialized bitwise
+struct C
+{
+    int a;
+    double b;
+
+    template <typename Archive>
+    void serialize(Archive & ar, unsigned)
+    {
+        ar & a & b;
+    }
+};
+
+HPX_IS_BITWISE_SERIALIZABLE(C)
+
+void test_bitwise()
+{
+    static_assert(hpx::traits::is_bitwise_serializable<C>::value,
+        "C should be bitwise serializable");
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+
+    // push to the front as well to make the blocks of the saved deque
+    // differ from the ones of the loaded deque
+    std::deque<C> os;
+    for (int i = 0; i != 1000; ++i)
+    {
+        os.push_back(C{i, i / 2.});
+        os.push_front(C{-i, -i / 2.});
+    }
+
+    oarchive << os;
+
+    hpx::serialization::input_archive iarchive(buffer);
+    std::deque<C> is;
+    iarchive >> is;
+    HPX_TEST_EQ(os.size(), is.size());
+    for (std::size_t i = 0; i < os.size(); ++i)
+    {
+        HPX_TEST_EQ(os[i].a, is[i].a);
+        HPX_TEST_EQ(os[i].b, is[i].b);
+    }
+}
+
 int main()
 {
     test_bool();
@@ -272,6 +318,7 @@ int main()
     test<double>(-100, 100);
 
     test_non_default_constructible();
+    test_bitwise();
 
     return hpx::util::report_errors();
 }
@@ -236,6 +236,33 @@ void test_long_vector_serialization()
         HPX_TEST_EQ(os[i], is[i]);
 }
 
+// the receiving end does not need to know the threshold used by the sender
+template <class T>
+void test_zero_copy_serialization_threshold(std::size_t threshold)
+{
+    std::vector<T> os1(5);
+    std::iota(os1.begin(), os1.end(), T());
+    std::vector<T> os2(100);
+    std::iota(os2.begin(), os2.end(), T());
+    std::vector<T> os3(10);
+    std::iota(os3.begin(), os3.end(), T());
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(
+        buffer, 0, &chunks, nullptr, threshold);
+    oarchive << os1 << os2 << os3;
+    oarchive.flush();
+    std::size_t size = oarchive.bytes_written();
+
+    std::vector<T> is1, is2, is3;
+    hpx::serialization::input_archive iarchive(buffer, size, &chunks);
+    iarchive >> is1 >> is2 >> is3;
+    HPX_TEST(os1 == is1);
+    HPX_TEST(os2 == is2);
+    HPX_TEST(os3 == is3);
+}
+
 void test_non_default_constructible()
 {
     std::vector<char> buffer;
@@ -305,6 +332,11 @@ int main()
     test_long_vector_serialization<double>();
     test_long_vector_serialization<std::int64_t>();
 
+    test_zero_copy_serialization_threshold<int>(1);
+    test_zero_copy_serialization_threshold<int>(64);
+    test_zero_copy_serialization_threshold<int>(std::size_t(-1));
+    test_zero_copy_serialization_threshold<double>(1);
+
     test_non_default_constructible();
 
     return hpx::util::report_errors();
@@ -128,6 +128,66 @@ void test_initialization_from_vector(std::size_t max_size)
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// a buffer received as a zero-copy chunk refers to the received memory if
+// the owner of the chunk is known
+template <typename T>
+void test_adopt_received_chunk(std::size_t size)
+{
+    hpx::serialization::serialize_buffer<T> send_buffer(size);
+    for (std::size_t i = 0; i != size; ++i)
+        send_buffer[i] = static_cast<T>(i);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(
+        buffer, 0, &chunks, nullptr, 1);
+    oarchive << send_buffer;
+    oarchive.flush();
+    std::size_t bytes = oarchive.bytes_written();
+
+    // copy the zero-copy chunks into separately owned memory, just like a
+    // parcelport would
+    std::vector<std::shared_ptr<void> > owners(chunks.size());
+    std::weak_ptr<std::vector<char> > received;
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        hpx::serialization::serialization_chunk& c = chunks[i];
+        if (c.type_ != hpx::serialization::chunk_type_pointer)
+            continue;
+
+        auto data = std::make_shared<std::vector<char> >(
+            static_cast<char const*>(c.data_.cpos_),
+            static_cast<char const*>(c.data_.cpos_) + c.size_);
+        c.data_.cpos_ = data->data();
+        owners[i] = data;
+        received = data;
+    }
+
+    hpx::serialization::serialize_buffer<T> recv_buffer;
+    {
+        hpx::serialization::input_archive iarchive(
+            buffer, bytes, &chunks, &owners);
+        iarchive >> recv_buffer;
+    }
+
+    HPX_TEST_EQ(recv_buffer.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(recv_buffer[i], static_cast<T>(i));
+
+    std::shared_ptr<std::vector<char> > data = received.lock();
+    HPX_TEST(data);
+    HPX_TEST_EQ(static_cast<void const*>(recv_buffer.data()),
+        static_cast<void const*>(data ? data->data() : nullptr));
+
+    // the received memory is kept alive by the buffer only
+    data.reset();
+    owners.clear();
+    HPX_TEST(!received.expired());
+    recv_buffer = hpx::serialization::serialize_buffer<T>();
+    HPX_TEST(received.expired());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(int argc, char* argv[])
 {
@@ -153,6 +213,9 @@ int hpx_main(int argc, char* argv[])
         test_fixed_size_initialization_for_persistent_buffers<double>(size);
     }
 
+    test_adopt_received_chunk<char>(1024);
+    test_adopt_received_chunk<double>(1024);
+
     return hpx::finalize();
 }
 
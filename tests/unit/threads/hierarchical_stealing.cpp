@@ -0,0 +1,109 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests the hierarchical stealing of the local-priority scheduler
+// (--hpx:numa-sensitive=3). All work is executed and the number of items
+// stolen from the different levels of the hierarchy is consistent with the
+// overall number of stolen items.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    // keep the worker threads busy for a while to give them a chance to
+    // steal from each other
+    hpx::util::high_resolution_timer t;
+    while (t.elapsed() < 1e-5)
+        ;
+    ++count;
+}
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+std::int64_t get_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(
+        "/threads{locality#0/total}/count/" + name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_stealing_counts()
+{
+    // the per-level counts are read first, they can't exceed the overall
+    // counts even if more items are stolen in the meantime
+    std::int64_t from_core = get_value("stolen-from-core");
+    std::int64_t from_numa_domain = get_value("stolen-from-numa-domain");
+    std::int64_t from_remote = get_value("stolen-from-remote-numa-domain");
+
+    std::int64_t stolen = get_value("stolen-from-pending") +
+        get_value("stolen-from-staged");
+
+    HPX_TEST(from_core >= 0);
+    HPX_TEST(from_numa_domain >= 0);
+    HPX_TEST(from_remote >= 0);
+    HPX_TEST(from_core + from_numa_domain + from_remote <= stolen);
+
+    // nothing can be stolen from remote NUMA domains if there are none
+    if (hpx::threads::get_topology().get_number_of_numa_nodes() <= 1)
+    {
+        HPX_TEST_EQ(from_remote, 0);
+    }
+}
+#endif
+
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.numa_sensitive", ""),
+        std::string("3"));
+
+    // spawn all work from a single worker thread, the other worker threads
+    // have to steal it
+    std::size_t expected = 0;
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != 1000; ++j)
+        {
+            futures.push_back(hpx::async(&work));
+        }
+        hpx::wait_all(futures);
+
+        expected += futures.size();
+    }
+    HPX_TEST_EQ(count.load(), expected);
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+    test_stealing_counts();
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // steal across NUMA domains after only a few failed attempts
+    std::vector<std::string> const cfg = {
+        "hpx.scheduler=local-priority-fifo",
+        "hpx.numa_sensitive=3",
+        "hpx.thread_queue.remote_steal_backoff=4"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
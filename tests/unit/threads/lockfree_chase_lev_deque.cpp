@@ -0,0 +1,141 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/lockfree/chase_lev_deque.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+typedef boost::lockfree::chase_lev_deque<std::uint64_t> deque_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_push_pop()
+{
+    deque_type d(16);
+    HPX_TEST(d.empty());
+
+    std::uint64_t val = 0;
+    HPX_TEST(!d.pop_bottom(val));
+    HPX_TEST(!d.steal(val));
+
+    // the owner pops in LIFO order, the array grows beyond its initial size
+    for (std::uint64_t i = 0; i != 100; ++i)
+        d.push_bottom(i);
+    HPX_TEST(!d.empty());
+
+    for (std::uint64_t i = 100; i != 0; --i)
+    {
+        HPX_TEST(d.pop_bottom(val));
+        HPX_TEST_EQ(val, i - 1);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop_bottom(val));
+}
+
+void test_steal_half()
+{
+    deque_type d(16);
+
+    std::uint64_t const count = 64;
+    for (std::uint64_t i = 0; i != count; ++i)
+        d.push_bottom(i);
+
+    // thieves take the oldest elements (FIFO order) ...
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != count / 2; ++i)
+    {
+        HPX_TEST(d.steal(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    // ... while the owner still sees the newest half of the elements
+    for (std::uint64_t i = count; i != count / 2; --i)
+    {
+        HPX_TEST(d.pop_bottom(val));
+        HPX_TEST_EQ(val, i - 1);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.steal(val));
+    HPX_TEST(!d.pop_bottom(val));
+
+    // the deque is usable after having been emptied
+    d.push_bottom(42);
+    HPX_TEST(d.steal(val));
+    HPX_TEST_EQ(val, std::uint64_t(42));
+}
+
+// every element is taken exactly once while the owner pushes and pops and
+// thieves concurrently steal elements
+void test_concurrent_steal()
+{
+    std::size_t const num_thieves = 3;
+    std::uint64_t const count = 100000;
+
+    deque_type d(16);
+    std::vector<std::atomic<int> > taken(count);
+    for (std::atomic<int>& t : taken)
+        t.store(0);
+
+    std::atomic<bool> done(false);
+    std::atomic<std::uint64_t> stolen(0);
+
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t val = 0;
+            while (!done.load())
+            {
+                if (d.steal(val))
+                {
+                    ++taken[val];
+                    ++stolen;
+                }
+            }
+        });
+    }
+
+    std::uint64_t popped = 0;
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        d.push_bottom(i);
+        if (i % 3 == 0 && d.pop_bottom(val))
+        {
+            ++taken[val];
+            ++popped;
+        }
+    }
+    while (d.pop_bottom(val))
+    {
+        ++taken[val];
+        ++popped;
+    }
+
+    done.store(true);
+    for (std::thread& t : thieves)
+        t.join();
+
+    HPX_TEST(d.empty());
+    HPX_TEST_EQ(popped + stolen.load(), count);
+    for (std::uint64_t i = 0; i != count; ++i)
+        HPX_TEST_EQ(taken[i].load(), 1);
+}
+
+int main()
+{
+    test_push_pop();
+    test_steal_half();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,111 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that the stacks of terminated HPX threads are reused by the
+// stack pool and that the related performance counters are available
+// exactly if the stack pool is used by the coroutine implementation.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/threads/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::size_t const low_watermark = 4;
+std::size_t const high_watermark = 1024;
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    ++count;
+}
+
+void run_threads()
+{
+    std::size_t expected = 0;
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != 100; ++j)
+        {
+            futures.push_back(hpx::async(&work));
+        }
+        hpx::wait_all(futures);
+
+        expected += futures.size();
+    }
+    HPX_TEST_EQ(count.load(), expected);
+}
+
+#if defined(HPX_HAVE_COROUTINE_STACK_POOL)
+void test_stack_pool()
+{
+    using hpx::performance_counters::performance_counter;
+
+    namespace posix = hpx::threads::coroutines::detail::posix;
+    HPX_TEST(posix::use_stack_pool());
+    HPX_TEST_EQ(posix::stack_pool_low_watermark, low_watermark);
+    HPX_TEST_EQ(posix::stack_pool_high_watermark, high_watermark);
+
+    performance_counter allocations(
+        "/threads{locality#0/total}/count/stack-allocations");
+    performance_counter reuses(
+        "/threads{locality#0/total}/count/stack-reuses");
+    performance_counter trims(
+        "/threads{locality#0/total}/count/stack-trims");
+
+    allocations.get_value<std::int64_t>(hpx::launch::sync, true);
+    reuses.get_value<std::int64_t>(hpx::launch::sync, true);
+    trims.get_value<std::int64_t>(hpx::launch::sync, true);
+
+    run_threads();
+
+    // the stacks of the threads of one round are reused by the next round,
+    // the stacks returned beyond the low watermark are trimmed
+    HPX_TEST(reuses.get_value<std::int64_t>(hpx::launch::sync) > 0);
+    HPX_TEST(trims.get_value<std::int64_t>(hpx::launch::sync) > 0);
+    HPX_TEST(allocations.get_value<std::int64_t>(hpx::launch::sync) >= 0);
+}
+#else
+void test_stack_pool()
+{
+    run_threads();
+
+    // the counters are not available if the stack pool is not used
+    for (char const* name : {"/threads/count/stack-allocations",
+             "/threads/count/stack-reuses", "/threads/count/stack-trims"})
+    {
+        hpx::error_code ec(hpx::lightweight);
+        std::vector<hpx::performance_counters::performance_counter>
+            counters = hpx::performance_counters::discover_counters(name, ec);
+        HPX_TEST(ec || counters.empty());
+    }
+}
+#endif
+
+int hpx_main()
+{
+    test_stack_pool();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.stacks.pool_low_watermark=" + std::to_string(low_watermark),
+        "hpx.stacks.pool_high_watermark=" + std::to_string(high_watermark)
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
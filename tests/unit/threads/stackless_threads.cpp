@@ -0,0 +1,109 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/thread_executors.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::thread::id test_stackless()
+{
+    HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+    HPX_TEST(hpx::threads::is_self_stackless());
+    HPX_TEST_EQ(std::string(hpx::threads::get_stack_size_name(
+        hpx::threads::get_self_stacksize())), std::string("nostack"));
+
+    return hpx::this_thread::get_id();
+}
+
+void test_async()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    HPX_TEST(!hpx::threads::is_self_stackless());
+    HPX_TEST(hpx::async(exec, &test_stackless).get() !=
+        hpx::this_thread::get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::async(exec, []() { throw std::runtime_error("error"); }).get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_suspension_forbidden()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    hpx::future<bool> f = hpx::async(exec, []() -> bool {
+            hpx::error_code ec(hpx::lightweight);
+            hpx::this_thread::suspend(
+                hpx::threads::pending, "test_suspension_forbidden", ec);
+            return ec.value() == hpx::invalid_status;
+        });
+
+    HPX_TEST(f.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_for_each()
+{
+    hpx::threads::executors::default_executor exec(
+        hpx::threads::thread_stacksize_nostack);
+
+    std::vector<std::size_t> c(10007, 0);
+    std::atomic<std::size_t> count(0);
+
+    hpx::parallel::for_each(hpx::parallel::execution::par.on(exec),
+        c.begin(), c.end(),
+        [&count](std::size_t& v)
+        {
+            v = 42;
+            ++count;
+        });
+
+    HPX_TEST_EQ(count.load(), c.size());
+    for (std::size_t v : c)
+    {
+        HPX_TEST_EQ(v, std::size_t(42));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_async();
+    test_exception();
+    test_suspension_forbidden();
+    test_for_each();
+
+    return hpx::util::report_errors();
+}
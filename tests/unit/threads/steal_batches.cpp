@@ -0,0 +1,110 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that the counters reporting the number and the sizes of the
+// batches moved by steal operations are consistent with each other.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/high_resolution_timer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::performance_counter;
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    // keep the worker threads busy for a while to give them a chance to
+    // steal from each other
+    hpx::util::high_resolution_timer t;
+    while (t.elapsed() < 1e-5)
+        ;
+    ++count;
+}
+
+void test_steal_batches(std::string const& instance)
+{
+    performance_counter batches(
+        "/threads{" + instance + "}/count/steal-batches");
+    performance_counter average(
+        "/threads{" + instance + "}/count/average-steal-batch-size");
+    performance_counter largest(
+        "/threads{" + instance + "}/count/max-steal-batch-size");
+
+    // the values are read in an order which keeps them consistent even if
+    // more steal operations happen in the meantime
+    std::int64_t average_size =
+        average.get_value<std::int64_t>(hpx::launch::sync);
+    std::int64_t max_size =
+        largest.get_value<std::int64_t>(hpx::launch::sync);
+    std::int64_t num_batches =
+        batches.get_value<std::int64_t>(hpx::launch::sync);
+
+    HPX_TEST(num_batches >= 0);
+    HPX_TEST(average_size >= 0);
+    HPX_TEST(average_size <= max_size);
+
+    if (num_batches == 0)
+    {
+        HPX_TEST_EQ(average_size, 0);
+        HPX_TEST_EQ(max_size, 0);
+    }
+
+    // resetting the batch sizes does not reset the number of steal
+    // operations
+    average.get_value<std::int64_t>(hpx::launch::sync, true);
+    largest.get_value<std::int64_t>(hpx::launch::sync, true);
+    HPX_TEST(batches.get_value<std::int64_t>(hpx::launch::sync) >=
+        num_batches);
+}
+
+int hpx_main()
+{
+    // spawn all work from a single worker thread, the other worker threads
+    // have to steal it
+    std::size_t expected = 0;
+    for (int i = 0; i != 10; ++i)
+    {
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != 1000; ++j)
+        {
+            futures.push_back(hpx::async(&work));
+        }
+        hpx::wait_all(futures);
+
+        expected += futures.size();
+    }
+    HPX_TEST_EQ(count.load(), expected);
+
+    test_steal_batches("locality#0/total");
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        test_steal_batches("locality#0/worker-thread#" + std::to_string(i));
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.thread_queue.max_steal_batch_size=16"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
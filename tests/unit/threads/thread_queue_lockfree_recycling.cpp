@@ -0,0 +1,96 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that thread objects can be recycled without holding the queue
+// lock (hpx.thread_queue.lockfree_recycling=1) while other threads enumerate
+// the existing threads concurrently.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> count(0);
+std::atomic<bool> done(false);
+
+void work()
+{
+    ++count;
+}
+
+std::size_t enumerate()
+{
+    std::size_t enumerations = 0;
+    while (!done.load())
+    {
+        std::int64_t found = 0;
+        hpx::threads::enumerate_threads(
+            [&found](hpx::threads::thread_id_type id) -> bool
+            {
+                // access the thread object while it may be recycled
+                hpx::threads::get_thread_description(id);
+                ++found;
+                return true;
+            });
+
+        // the enumerating thread itself is always found
+        HPX_TEST(found > 0);
+
+        ++enumerations;
+        hpx::this_thread::yield();
+    }
+    return enumerations;
+}
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<std::size_t> > enumerators;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        enumerators.push_back(hpx::async(&enumerate));
+    }
+
+    std::size_t expected = 0;
+    for (int i = 0; i != 100; ++i)
+    {
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != 16 * num_threads; ++j)
+        {
+            futures.push_back(hpx::async(&work));
+        }
+        hpx::wait_all(futures);
+
+        expected += futures.size();
+    }
+    HPX_TEST_EQ(count.load(), expected);
+
+    done = true;
+    for (hpx::future<std::size_t>& f : enumerators)
+    {
+        HPX_TEST(f.get() > 0);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // recycle thread objects without holding the queue lock
+    std::vector<std::string> const cfg = {
+        "hpx.thread_queue.lockfree_recycling=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
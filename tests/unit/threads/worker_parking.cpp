@@ -0,0 +1,79 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests that idle worker threads are parked and woken up for new work,
+// and that the related performance counters are independent of each other.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::performance_counter;
+
+std::atomic<std::size_t> count(0);
+
+void work()
+{
+    ++count;
+}
+
+int hpx_main()
+{
+    performance_counter parks(
+        "/threads{locality#0/total}/count/worker-parks");
+    performance_counter unparks(
+        "/threads{locality#0/total}/count/worker-unparks");
+    performance_counter latency(
+        "/threads{locality#0/total}/time/average-wake-latency");
+
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    // let the worker threads become idle in between spawning new work
+    std::size_t expected = 0;
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        std::vector<hpx::future<void> > futures;
+        for (std::size_t j = 0; j != 4 * num_threads; ++j)
+        {
+            futures.push_back(hpx::async(&work));
+        }
+        hpx::wait_all(futures);
+
+        expected += futures.size();
+    }
+    HPX_TEST_EQ(count.load(), expected);
+
+    // idle threads were parked and woken up for the new work
+    HPX_TEST(parks.get_value<std::int64_t>(hpx::launch::sync) > 0);
+
+    std::int64_t num_unparks =
+        unparks.get_value<std::int64_t>(hpx::launch::sync);
+    HPX_TEST(num_unparks > 0);
+
+    // resetting the average latency does not reset the number of wake-ups
+    HPX_TEST(latency.get_value<std::int64_t>(hpx::launch::sync, true) >= 0);
+    HPX_TEST(unparks.get_value<std::int64_t>(hpx::launch::sync) >=
+        num_unparks);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
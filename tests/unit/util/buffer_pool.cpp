@@ -0,0 +1,98 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/util/buffer_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+typedef hpx::util::buffer_pool<char> pool_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    std::shared_ptr<pool_type> pool = std::make_shared<pool_type>(2, 4096);
+
+    // released buffers are handed out again
+    pool->get_pooled_buffer(1000);
+    HPX_TEST_EQ(pool->get_allocation_count(false), std::int64_t(1));
+
+    pool_type::shared_buffer_type buffer = pool->get_pooled_buffer(1024);
+    HPX_TEST_EQ(buffer->size(), std::size_t(1024));
+    HPX_TEST_EQ(pool->get_allocation_count(false), std::int64_t(1));
+    HPX_TEST_EQ(pool->get_reuse_count(false), std::int64_t(1));
+}
+
+void test_max_cached_buffers()
+{
+    std::shared_ptr<pool_type> pool = std::make_shared<pool_type>(2, 4096);
+
+    // at most two buffers of the same size class are kept
+    {
+        std::vector<pool_type::shared_buffer_type> buffers;
+        for (int i = 0; i != 3; ++i)
+            buffers.push_back(pool->get_pooled_buffer(256));
+    }
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(3));
+
+    std::vector<pool_type::shared_buffer_type> buffers;
+    for (int i = 0; i != 3; ++i)
+        buffers.push_back(pool->get_pooled_buffer(256));
+
+    HPX_TEST_EQ(pool->get_reuse_count(false), std::int64_t(2));
+    HPX_TEST_EQ(pool->get_allocation_count(false), std::int64_t(1));
+}
+
+void test_max_cached_bytes()
+{
+    std::shared_ptr<pool_type> pool = std::make_shared<pool_type>(16, 4096);
+
+    // buffers larger than the overall limit are not kept
+    pool->get_pooled_buffer(8192);
+    pool->get_pooled_buffer(8192);
+    HPX_TEST_EQ(pool->get_reuse_count(false), std::int64_t(0));
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(2));
+
+    // the buffers kept don't exceed the limit, only two out of these three
+    // buffers fit into 4096 bytes
+    {
+        std::vector<pool_type::shared_buffer_type> buffers;
+        for (int i = 0; i != 3; ++i)
+            buffers.push_back(pool->get_pooled_buffer(2048));
+    }
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(3));
+
+    {
+        std::vector<pool_type::shared_buffer_type> buffers;
+        for (int i = 0; i != 3; ++i)
+            buffers.push_back(pool->get_pooled_buffer(2048));
+    }
+    HPX_TEST_EQ(pool->get_reuse_count(true), std::int64_t(2));
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(1));
+
+    // the limit applies to all size classes together
+    pool->get_pooled_buffer(1024);
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(1));
+    pool->get_pooled_buffer(1024);
+    HPX_TEST_EQ(pool->get_allocation_count(true), std::int64_t(1));
+
+    // clearing the pool makes room for other buffers
+    pool->clear();
+    pool->get_pooled_buffer(4096);
+    pool->get_pooled_buffer(4096);
+    HPX_TEST_EQ(pool->get_reuse_count(true), std::int64_t(1));
+}
+
+int main()
+{
+    test_reuse();
+    test_max_cached_buffers();
+    test_max_cached_bytes();
+
+    return hpx::util::report_errors();
+}
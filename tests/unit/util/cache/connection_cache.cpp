@@ -0,0 +1,107 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/connection_cache.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+struct connection {};
+
+typedef hpx::util::connection_cache<connection, int> cache_type;
+typedef cache_type::connection_type connection_type;
+
+// create a new connection to the given key and hand it back to the cache
+void connect(cache_type& cache, int key)
+{
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(key, conn));
+    HPX_TEST(!conn);
+
+    cache.reclaim(key, std::make_shared<connection>());
+}
+
+// check out an existing connection to the given key and hand it back
+void use(cache_type& cache, int key)
+{
+    connection_type conn = cache.get(key);
+    HPX_TEST(conn);
+
+    cache.reclaim(key, conn);
+}
+
+// Key 1 is used often but not recently, key 2 is used recently but less
+// often. Then make space for a connection to key 3, which evicts one of them.
+void fill(cache_type& cache)
+{
+    connect(cache, 1);
+    use(cache, 1);
+    use(cache, 1);
+    use(cache, 1);
+
+    connect(cache, 2);
+    use(cache, 2);
+
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(3, conn));
+    HPX_TEST(!conn);
+    HPX_TEST_EQ(cache.get_cache_evictions(false), 1);
+}
+
+void test_lru()
+{
+    cache_type cache(2, 2, hpx::util::connection_cache_lru);
+    fill(cache);
+
+    // the least recently used connection was evicted
+    HPX_TEST(!cache.get(1));
+    use(cache, 2);
+
+    // connecting to key 1 again is a reconnect
+    HPX_TEST_EQ(cache.get_cache_reconnects(false), 0);
+
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(1, conn));
+    HPX_TEST(!conn);
+    HPX_TEST_EQ(cache.get_cache_reconnects(false), 1);
+}
+
+void test_lfu()
+{
+    cache_type cache(2, 2, hpx::util::connection_cache_lfu);
+    fill(cache);
+
+    // the least frequently used connection was evicted
+    HPX_TEST(!cache.get(2));
+    use(cache, 1);
+}
+
+void test_pinned()
+{
+    cache_type cache(2, 2, hpx::util::connection_cache_lru);
+
+    connect(cache, 1);
+    cache.pin(1);
+    connect(cache, 2);
+
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(3, conn));
+    HPX_TEST(!conn);
+
+    // key 1 is the least recently used, but it is pinned
+    use(cache, 1);
+    HPX_TEST(!cache.get(2));
+}
+
+int main()
+{
+    test_lru();
+    test_lfu();
+    test_pinned();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,247 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests writing and restoring checkpoint files consisting of named
+// sections.
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/util/checkpoint_file.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file;
+using hpx::util::checkpoint_file_writer;
+
+///////////////////////////////////////////////////////////////////////////////
+// opening the given file has to fail with the given error
+void test_open_fails(std::string const& filename, hpx::error expected)
+{
+    bool caught_exception = false;
+    try {
+        checkpoint_file file(filename);
+    }
+    catch (hpx::exception const& e) {
+        HPX_TEST_EQ(e.get_error(), expected);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+std::vector<char> read_file(std::string const& filename)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>());
+}
+
+void write_file(std::string const& filename, char const* data,
+    std::size_t size)
+{
+    std::ofstream out(filename,
+        std::ios::out | std::ios::trunc | std::ios::binary);
+    out.write(data, static_cast<std::streamsize>(size));
+}
+
+void test_compressed_section()
+{
+#if defined(HPX_HAVE_COMPRESSION_ZLIB) || defined(HPX_HAVE_COMPRESSION_BZIP2) ||\
+    defined(HPX_HAVE_COMPRESSION_SNAPPY) || defined(HPX_HAVE_COMPRESSION_LZ4)
+#if defined(HPX_HAVE_COMPRESSION_ZLIB)
+    std::string const compression = "zlib_serialization_filter";
+#elif defined(HPX_HAVE_COMPRESSION_BZIP2)
+    std::string const compression = "bzip2_serialization_filter";
+#elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
+    std::string const compression = "snappy_serialization_filter";
+#else
+    std::string const compression = "lz4_serialization_filter";
+#endif
+    std::string const filename = "checkpoint_file_compressed_test.ckpt";
+
+    // highly compressible data
+    std::vector<int> ints(100000, 42);
+    std::string name = "a compressed section";
+
+    checkpoint_file_writer writer;
+    writer.add_compressed_section("compressed", 1, compression, ints, name);
+    writer.add_section("plain", 1, ints);
+    writer.write(filename).get();
+
+    {
+        checkpoint_file file(filename);
+
+        HPX_TEST_EQ(file.get_section_info("compressed").compression_,
+            compression);
+        HPX_TEST(file.get_section_info("plain").compression_.empty());
+        HPX_TEST(file.get_section_info("compressed").size_ <
+            file.get_section_info("plain").size_);
+
+        std::vector<int> ints2;
+        std::string name2;
+        file.restore_section("compressed", ints2, name2);
+        HPX_TEST(ints == ints2);
+        HPX_TEST_EQ(name, name2);
+    }
+
+    std::remove(filename.c_str());
+#endif
+}
+
+void test_invalid_files()
+{
+    std::string const filename = "checkpoint_file_invalid_test.ckpt";
+    std::string const invalid = "checkpoint_file_invalid_test_2.ckpt";
+
+    std::vector<double> values(1000, 1.0);
+
+    checkpoint_file_writer writer;
+    writer.add_array("values", 1, values);
+    writer.write(filename).get();
+
+    std::vector<char> data = read_file(filename);
+    HPX_TEST(data.size() > 1000 * sizeof(double));
+
+    // non-existing file
+    test_open_fails("checkpoint_file_does_not_exist.ckpt",
+        hpx::filesystem_error);
+
+    // files which are too short for the header or hold something else
+    write_file(invalid, data.data(), 8);
+    test_open_fails(invalid, hpx::serialization_error);
+
+    std::vector<char> foreign(data.size(), 'x');
+    write_file(invalid, foreign.data(), foreign.size());
+    test_open_fails(invalid, hpx::serialization_error);
+
+    // files written on a platform with a different byte order or using a
+    // newer format version (the header starts with the 8 byte magic number
+    // followed by the 32 bit format version and byte order flag)
+    std::vector<char> modified = data;
+    modified[12] = static_cast<char>(modified[12] ^ 1);
+    write_file(invalid, modified.data(), modified.size());
+    test_open_fails(invalid, hpx::serialization_error);
+
+    modified = data;
+    std::uint32_t version = 0;
+    std::memcpy(&version, &modified[8], sizeof(version));
+    ++version;
+    std::memcpy(&modified[8], &version, sizeof(version));
+    write_file(invalid, modified.data(), modified.size());
+    test_open_fails(invalid, hpx::serialization_error);
+
+    // truncated files, the file is padded after the last section
+    std::size_t end = 0;
+    {
+        checkpoint_file file(filename);
+        hpx::util::checkpoint_section_info const& info =
+            file.get_section_info("values");
+        end = static_cast<std::size_t>(info.offset_ + info.size_);
+    }
+    HPX_TEST(end <= data.size());
+
+    write_file(invalid, data.data(), end - 1);
+    test_open_fails(invalid, hpx::serialization_error);
+
+    write_file(invalid, data.data(), 40);
+    test_open_fails(invalid, hpx::serialization_error);
+
+    // the unmodified file can be opened
+    write_file(invalid, data.data(), data.size());
+    {
+        checkpoint_file file(invalid);
+        HPX_TEST_EQ(std::size_t(file.get_array<double>("values").size()),
+            values.size());
+    }
+
+    std::remove(invalid.c_str());
+    std::remove(filename.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_compressed_section();
+    test_invalid_files();
+
+    std::string const filename = "checkpoint_file_test.ckpt";
+
+    std::vector<double> values(10007);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = 0.5 * double(i);
+
+    std::string name = "a string stored in a checkpoint section";
+    std::vector<int> ints{1, 2, 3, 4, 5};
+    std::int64_t step = 42;
+
+    //[checkpoint_file_write
+    checkpoint_file_writer writer;
+    writer.add_array("values", 1, values);
+    writer.add_section("state", 2, name, ints);
+    writer.add_section("step", 1, step);
+    writer.write(filename).get();
+    //]
+
+    {
+        //[checkpoint_file_restore
+        checkpoint_file file(filename);
+
+        // arrays are used directly from the mapped file
+        auto restored_values = file.get_array<double>("values");
+
+        // independent sections can be restored in parallel
+        std::string name2;
+        std::vector<int> ints2;
+        std::int64_t step2 = 0;
+        hpx::future<void> f1 =
+            file.async_restore_section("state", name2, ints2);
+        hpx::future<void> f2 = file.async_restore_section("step", step2);
+        hpx::wait_all(f1, f2);
+        //]
+
+        HPX_TEST_EQ(file.sections().size(), std::size_t(3));
+        HPX_TEST(file.has_section("state"));
+        HPX_TEST(!file.has_section("unknown"));
+        HPX_TEST_EQ(file.get_section_info("state").version_, 2u);
+        HPX_TEST(file.get_section_info("values").is_array());
+
+        HPX_TEST_EQ(std::size_t(restored_values.size()), values.size());
+        HPX_TEST(std::equal(values.begin(), values.end(),
+            restored_values.begin()));
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(
+            restored_values.begin()) % alignof(double), std::uintptr_t(0));
+
+        HPX_TEST_EQ(name, name2);
+        HPX_TEST(ints == ints2);
+        HPX_TEST_EQ(step, step2);
+
+        std::vector<double> values2;
+        file.restore_array("values", values2);
+        HPX_TEST(values == values2);
+
+        // sections have to be accessed as what they were stored as
+        bool caught_exception = false;
+        try {
+            file.get_array<double>("state");
+        }
+        catch (hpx::exception const&) {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    std::remove(filename.c_str());
+
+    return hpx::util::report_errors();
+}
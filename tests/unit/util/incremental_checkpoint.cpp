@@ -0,0 +1,117 @@
+//  Copyright (c) 2019 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This tests creating incremental checkpoints and restoring them from a base
+// checkpoint and a chain of deltas.
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/util/checkpoint.hpp>
+#include <hpx/util/incremental_checkpoint.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::util::apply_checkpoint_deltas;
+using hpx::util::checkpoint;
+using hpx::util::incremental_checkpoint;
+using hpx::util::restore_incremental_checkpoint;
+using hpx::util::save_checkpoint;
+
+// create the first delta for a base with the given digest, without any data
+checkpoint make_delta(std::uint64_t base_digest, std::uint64_t block_size,
+    std::uint64_t size, std::vector<std::uint64_t> const& changed)
+{
+    std::vector<char> data;
+    {
+        hpx::serialization::output_archive ar(data);
+        ar << base_digest << std::uint64_t(1) << block_size << size
+           << changed;
+    }
+    return checkpoint(std::move(data));
+}
+
+bool is_corrupted(checkpoint const& delta)
+{
+    try {
+        apply_checkpoint_deltas(checkpoint(), std::vector<checkpoint>{delta});
+    }
+    catch (hpx::exception const& e) {
+        return e.get_error() == hpx::serialization_error;
+    }
+    return false;
+}
+
+int main()
+{
+    std::vector<double> state(100000, 1.0);
+    int step = 0;
+
+    //[incremental_checkpoint_save
+    checkpoint base = save_checkpoint(hpx::launch::sync, state, step);
+
+    incremental_checkpoint tracker(base);
+    std::vector<checkpoint> deltas;
+    for (step = 1; step != 4; ++step)
+    {
+        // modify a small part of the state only
+        state[step * 1000] = double(step);
+        deltas.push_back(tracker.save(state, step).get());
+    }
+    //]
+
+    HPX_TEST_EQ(tracker.sequence(), std::size_t(3));
+    for (checkpoint const& delta : deltas)
+        HPX_TEST(delta.size() < base.size() / 10);
+
+    //[incremental_checkpoint_restore
+    std::vector<double> restored_state;
+    int restored_step = 0;
+    restore_incremental_checkpoint(
+        base, deltas, restored_state, restored_step);
+    //]
+
+    HPX_TEST(state == restored_state);
+    HPX_TEST_EQ(restored_step, 3);
+
+    // a state of a different size
+    state.resize(50000);
+    deltas.push_back(tracker.save(hpx::launch::sync, state, step));
+    HPX_TEST(
+        apply_checkpoint_deltas(base, deltas) ==
+        save_checkpoint(hpx::launch::sync, state, step));
+
+    // deltas don't apply to a different base
+    bool caught_exception = false;
+    try {
+        apply_checkpoint_deltas(checkpoint(), deltas);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // a checkpoint created without a base starts with the full state
+    incremental_checkpoint full_tracker;
+    std::vector<checkpoint> full_deltas;
+    full_deltas.push_back(full_tracker.save(hpx::launch::sync, state));
+    std::vector<double> restored_state2;
+    restore_incremental_checkpoint(checkpoint(), full_deltas, restored_state2);
+    HPX_TEST(state == restored_state2);
+
+    // corrupted deltas are rejected before the state is resized
+    std::uint64_t const empty_base_digest =
+        hpx::util::detail::checkpoint_digest(std::vector<std::uint64_t>());
+    HPX_TEST(is_corrupted(make_delta(empty_base_digest, 4096,
+        std::uint64_t(1) << 60, std::vector<std::uint64_t>())));
+    HPX_TEST(is_corrupted(make_delta(empty_base_digest, 4096, 8,
+        std::vector<std::uint64_t>{1})));
+    HPX_TEST(is_corrupted(make_delta(empty_base_digest, 0, 4096,
+        std::vector<std::uint64_t>())));
+
+    return hpx::util::report_errors();
+}